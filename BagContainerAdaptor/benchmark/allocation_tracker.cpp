@@ -0,0 +1,237 @@
+#include "allocation_tracker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// Stored right in front of every block, the block itself starts at the first suitably aligned address after it.
+struct AllocationHeader
+{
+    void* base;
+    std::size_t size;
+};
+
+static std::atomic<long long> trackedAllocations(0);
+static std::atomic<long long> trackedDeallocations(0);
+static std::atomic<long long> trackedAllocatedBytes(0);
+static std::atomic<long long> trackedFreedBytes(0);
+static std::atomic<long long> trackedLiveBytes(0);
+static std::atomic<long long> trackedBaselineBytes(0);
+static std::atomic<long long> trackedPeakBytes(0);
+
+static void updatePeak(long long live) noexcept
+{
+    const long long above = live - trackedBaselineBytes.load(std::memory_order_relaxed);
+    long long peak = trackedPeakBytes.load(std::memory_order_relaxed);
+    while (above > peak && !trackedPeakBytes.compare_exchange_weak(peak, above, std::memory_order_relaxed))
+    {
+    }
+}
+
+// Throwing allocation as the standard specifies it, calling the new handler until it gives up.
+static void* allocateOrThrow(std::size_t size, std::size_t alignment)
+{
+    for (;;)
+    {
+        void* pointer = AllocationTracker::allocate(size, alignment);
+        if (pointer != nullptr)
+        {
+            return pointer;
+        }
+
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
+
+static void* allocateOrNull(std::size_t size, std::size_t alignment) noexcept
+{
+    try
+    {
+        return allocateOrThrow(size, alignment);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+
+void AllocationTracker::reset() noexcept
+{
+    trackedAllocations = 0;
+    trackedDeallocations = 0;
+    trackedAllocatedBytes = 0;
+    trackedFreedBytes = 0;
+    trackedBaselineBytes = trackedLiveBytes.load();
+    trackedPeakBytes = 0;
+}
+
+AllocationStatistics AllocationTracker::statistics() noexcept
+{
+    AllocationStatistics statistics;
+    statistics.allocations = trackedAllocations;
+    statistics.deallocations = trackedDeallocations;
+    statistics.allocatedBytes = trackedAllocatedBytes;
+    statistics.freedBytes = trackedFreedBytes;
+    statistics.peakLiveBytes = trackedPeakBytes;
+    return statistics;
+}
+
+long long AllocationTracker::liveBytes() noexcept
+{
+    return trackedLiveBytes;
+}
+
+void* AllocationTracker::allocate(std::size_t size, std::size_t alignment) noexcept
+{
+    alignment = std::max(alignment, alignof(std::max_align_t));
+
+    const std::size_t overhead = sizeof(AllocationHeader) + alignment - 1;
+    if (size > SIZE_MAX - overhead)
+    {
+        return nullptr;
+    }
+
+    void* base = std::malloc(size + overhead);
+    if (base == nullptr)
+    {
+        return nullptr;
+    }
+
+    const auto first = reinterpret_cast<std::uintptr_t>(base) + sizeof(AllocationHeader);
+    void* pointer = reinterpret_cast<void*>((first + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1));
+    static_cast<AllocationHeader*>(pointer)[-1] = AllocationHeader{base, size};
+
+    const auto bytes = static_cast<long long>(size);
+    trackedAllocations.fetch_add(1, std::memory_order_relaxed);
+    trackedAllocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    updatePeak(trackedLiveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+
+    return pointer;
+}
+
+void AllocationTracker::deallocate(void* pointer) noexcept
+{
+    if (pointer == nullptr)
+    {
+        return;
+    }
+
+    const AllocationHeader header = static_cast<AllocationHeader*>(pointer)[-1];
+
+    const auto bytes = static_cast<long long>(header.size);
+    trackedDeallocations.fetch_add(1, std::memory_order_relaxed);
+    trackedFreedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    trackedLiveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+
+    std::free(header.base);
+}
+
+void* operator new(std::size_t size)
+{
+    return allocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocateOrThrow(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocateOrNull(size, alignof(std::max_align_t));
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocateOrNull(size, alignof(std::max_align_t));
+}
+
+void operator delete(void* pointer) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+void operator delete(void* pointer, const std::nothrow_t&) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+// The size the caller passes is the one it allocated, the header already knows it.
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+#ifdef __cpp_aligned_new
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocateOrThrow(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocateOrNull(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    return allocateOrNull(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    AllocationTracker::deallocate(pointer);
+}
+#endif
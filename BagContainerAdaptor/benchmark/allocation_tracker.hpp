@@ -0,0 +1,40 @@
+#ifndef ALLOCATION_TRACKER_HPP
+#define ALLOCATION_TRACKER_HPP
+
+#include <cstddef>
+
+// What the global operator new and delete did since the last reset.
+struct AllocationStatistics
+{
+    long long allocations = 0;
+    long long deallocations = 0;
+    long long allocatedBytes = 0;
+    long long freedBytes = 0;
+
+    // The most bytes that were live at once, not counting what was already live at the reset.
+    long long peakLiveBytes = 0;
+};
+
+// Bookkeeping of the replacement global operator new and delete in allocation_tracker.cpp.
+// Every form of the operators is replaced: single object and array, sized, nothrow and, from C++17, aligned.
+// Each block carries its size in a header in front of it, so the unsized delete knows what it frees.
+// The counters are atomic, so allocations of other threads are counted as well.
+class AllocationTracker
+{
+public:
+    // Start counting from zero, the bytes that are live now become the baseline of the peak.
+    static void reset() noexcept;
+
+    static AllocationStatistics statistics() noexcept;
+
+    // Bytes allocated through the tracker and not yet freed.
+    static long long liveBytes() noexcept;
+
+    // Allocate `size` bytes aligned to `alignment`, nullptr when out of memory.
+    static void* allocate(std::size_t size, std::size_t alignment) noexcept;
+
+    // Free a block returned by allocate, nullptr is ignored.
+    static void deallocate(void* pointer) noexcept;
+};
+
+#endif
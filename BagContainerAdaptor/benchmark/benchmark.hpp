@@ -2,10 +2,17 @@
 #define BENCHMARK_HPP
 
 #include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/counted_multiset.hpp>
+#include <BagContainerAdaptor/linked_list.hpp>
+#include <BagContainerAdaptor/pool_allocator.hpp>
+#include <BagContainerAdaptor/unrolled_linked_list.hpp>
+
+#include "harness.hpp"
 
 #include <chrono>
 #include <functional>
 #include <iostream>
+#include <vector>
 
 // Insert, remove and lookup functions for BagContainerAdaptor and the underlying type.
 template <typename Container>
@@ -34,22 +41,64 @@ public:
         }
     }
 
-    static void containerErase(size_t amount, const value_type& value)
+    static void bagInsertCopy(size_t amount, const value_type& value)
     {
-        Container container;
+        BagContainerAdaptor<value_type, Container> adapter;
 
         for (size_t i = 0; i < amount; i++)
         {
-            container.insert(container.begin(), value);
+            const value_type temporary(value);
+            adapter.insert(temporary);
         }
+    }
+
+    static void bagInsertMove(size_t amount, const value_type& value)
+    {
+        BagContainerAdaptor<value_type, Container> adapter;
 
         for (size_t i = 0; i < amount; i++)
         {
-            container.erase(container.begin());
+            adapter.insert(value_type(value));
         }
     }
 
-    static void bagErase(size_t amount, const value_type& value)
+    static void bagEmplace(size_t amount, const value_type& value)
+    {
+        BagContainerAdaptor<value_type, Container> adapter;
+
+        for (size_t i = 0; i < amount; i++)
+        {
+            adapter.emplace(value);
+        }
+    }
+
+    // The source range is built by the harness as the fixture, the bag is built and filled in the timed region.
+    static void bagInsertRange(const std::vector<value_type>& values)
+    {
+        BagContainerAdaptor<value_type, Container> adapter;
+
+        adapter.reserve(values.size());
+        adapter.insert(values.begin(), values.end());
+    }
+
+    // Fixtures for the benchmarks below, built by the harness before the clock starts.
+    static std::vector<value_type> range(size_t amount, const value_type& value)
+    {
+        return std::vector<value_type>(amount, value);
+    }
+
+    static Container filledContainer(size_t amount, const value_type& value)
+    {
+        Container container;
+
+        for (size_t i = 0; i < amount; i++)
+        {
+            container.insert(container.begin(), value);
+        }
+        return container;
+    }
+
+    static BagContainerAdaptor<value_type, Container> filledBag(size_t amount, const value_type& value)
     {
         BagContainerAdaptor<value_type, Container> adapter;
 
@@ -57,14 +106,30 @@ public:
         {
             adapter.insert(value);
         }
+        return adapter;
+    }
+
+    // Every other element is `value`, the rest are default constructed.
+    static BagContainerAdaptor<value_type, Container> halfFilledBag(size_t amount, const value_type& value)
+    {
+        BagContainerAdaptor<value_type, Container> adapter;
 
         for (size_t i = 0; i < amount; i++)
         {
-            adapter.erase(adapter.begin());
+            if (i % 2 == 0)
+            {
+                adapter.insert(value);
+            }
+            else
+            {
+                adapter.insert(value_type());
+            }
         }
+        return adapter;
     }
 
-    static void containerLookup(size_t amount, const value_type& target)
+    // The target is the only element that is not default constructed, inserted when half of the elements are in.
+    static Container lookupContainer(size_t amount, const value_type& target)
     {
         Container container;
 
@@ -82,16 +147,10 @@ public:
                 container.insert(container.end(), temp);
             }
         }
-
-        auto found = std::find(container.begin(), container.end(), target);
-
-        if (found == container.end())
-        {
-            std::cerr << "Could not find target from container!" << std::endl;
-        }
+        return container;
     }
 
-    static void bagLookup(size_t amount, const value_type& target)
+    static BagContainerAdaptor<value_type, Container> lookupBag(size_t amount, const value_type& target)
     {
         BagContainerAdaptor<value_type, Container> adapter;
 
@@ -109,33 +168,564 @@ public:
                 adapter.insert(temp);
             }
         }
+        return adapter;
+    }
+
+    // Erase the first element until the filled container is empty, one operation per element.
+    static void containerErase(Container& container)
+    {
+        while (!container.empty())
+        {
+            container.erase(container.begin());
+        }
+    }
+
+    static void bagErase(BagContainerAdaptor<value_type, Container>& adapter)
+    {
+        while (!adapter.empty())
+        {
+            adapter.erase(adapter.begin());
+        }
+    }
+
+    // Call back() `repeats` times on the filled bag.
+    static void bagBack(BagContainerAdaptor<value_type, Container>& adapter, size_t repeats, const value_type& value)
+    {
+        size_t matches = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            // The bag does not change, do not let the result of one call be reused.
+            clobberMemory();
+            if (adapter.back() == value)
+            {
+                matches++;
+            }
+        }
 
-        auto found = adapter.find(target);
+        if (matches != repeats)
+        {
+            std::cerr << "Unexpected back element in bag!" << std::endl;
+        }
+    }
+
+    // One erase by value, removing half of the elements of the half filled bag.
+    static void bagEraseValue(BagContainerAdaptor<value_type, Container>& adapter, const value_type& value)
+    {
+        doNotOptimize(adapter.erase(value));
+    }
+
+    static void bagEraseIf(BagContainerAdaptor<value_type, Container>& adapter, const value_type& value)
+    {
+        doNotOptimize(adapter.erase_if([&value](const value_type& element) { return element == value; }));
+    }
+
+    // Look up the target `repeats` times.
+    static void containerLookup(const Container& container, size_t repeats, const value_type& target)
+    {
+        size_t misses = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            clobberMemory();
+            if (std::find(container.begin(), container.end(), target) == container.end())
+            {
+                misses++;
+            }
+        }
+
+        if (misses != 0)
+        {
+            std::cerr << "Could not find target from container!" << std::endl;
+        }
+    }
+
+    static void bagLookup(const BagContainerAdaptor<value_type, Container>& adapter, size_t repeats, const value_type& target)
+    {
+        size_t misses = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            clobberMemory();
+            if (adapter.find(target) == adapter.cend())
+            {
+                misses++;
+            }
+        }
 
-        if (found == adapter.end())
+        if (misses != 0)
         {
             std::cerr << "Could not find target from bag!" << std::endl;
         }
     }
 };
 
-// Same functions but for std::forward_list.
+// Erasing by value from the associative containers, which have their own erase(key) to compare against.
+// The containers hold `amount` elements with `distinct` different values, each erase removes all copies of one value.
+template <typename Container>
+class EraseValueBenchmark
+{
+public:
+    using value_type = typename Container::value_type;
+
+    static Container filledContainer(size_t amount, size_t distinct)
+    {
+        Container container;
+
+        for (size_t i = 0; i < amount; i++)
+        {
+            container.insert(static_cast<value_type>(i % distinct));
+        }
+        return container;
+    }
+
+    static BagContainerAdaptor<value_type, Container> filledBag(size_t amount, size_t distinct)
+    {
+        BagContainerAdaptor<value_type, Container> adapter;
+
+        for (size_t i = 0; i < amount; i++)
+        {
+            adapter.insert(static_cast<value_type>(i % distinct));
+        }
+        return adapter;
+    }
+
+    static void containerEraseValue(Container& container, size_t distinct)
+    {
+        for (size_t i = 0; i < distinct; i++)
+        {
+            container.erase(static_cast<value_type>(i));
+        }
+    }
+
+    static void bagEraseValue(BagContainerAdaptor<value_type, Container>& adapter, size_t distinct)
+    {
+        for (size_t i = 0; i < distinct; i++)
+        {
+            adapter.erase(static_cast<value_type>(i));
+        }
+    }
+};
+
+// Searching contiguous bags of arithmetic types against the scalar algorithms over the same elements.
+// The looked up value for find is only the last element, the counted and erased value is every hundredth element.
 template <typename T>
-class ForwardListBenchmark
+class SearchBenchmark
 {
 public:
-    static void insert(size_t amount, T value)
+    static void containerFind(size_t amount, size_t repeats)
     {
-        std::forward_list<T> list;
-        auto it = list.before_begin();
+        const std::vector<T> container = values(amount);
+
+        size_t misses = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            // The searched elements do not change, do not let the search be hoisted out of the loop.
+            clobberMemory();
+            if (std::find(container.begin(), container.end(), static_cast<T>(0)) == container.end())
+            {
+                misses++;
+            }
+        }
+
+        if (misses != 0)
+        {
+            std::cerr << "Could not find target from container!" << std::endl;
+        }
+    }
+
+    static void bagFind(size_t amount, size_t repeats)
+    {
+        const std::vector<T> container = values(amount);
+        BagContainerAdaptor<T, std::vector<T>> adapter;
+        adapter.insert(container.begin(), container.end());
+
+        size_t misses = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            clobberMemory();
+            if (adapter.find(static_cast<T>(0)) == adapter.end())
+            {
+                misses++;
+            }
+        }
+
+        if (misses != 0)
+        {
+            std::cerr << "Could not find target from bag!" << std::endl;
+        }
+    }
+
+    static void containerCount(size_t amount, size_t repeats)
+    {
+        const std::vector<T> container = values(amount);
+
+        size_t total = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            clobberMemory();
+            total += static_cast<size_t>(std::count(container.begin(), container.end(), static_cast<T>(1)));
+        }
+
+        if (total != repeats * ((amount + 98) / 100))
+        {
+            std::cerr << "Unexpected count from container!" << std::endl;
+        }
+    }
+
+    static void bagCount(size_t amount, size_t repeats)
+    {
+        const std::vector<T> container = values(amount);
+        BagContainerAdaptor<T, std::vector<T>> adapter;
+        adapter.insert(container.begin(), container.end());
+
+        size_t total = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            clobberMemory();
+            total += adapter.count(static_cast<T>(1));
+        }
+
+        if (total != repeats * ((amount + 98) / 100))
+        {
+            std::cerr << "Unexpected count from bag!" << std::endl;
+        }
+    }
+
+    static void containerEraseValue(size_t amount, size_t repeats)
+    {
+        const std::vector<T> container = values(amount);
+
+        for (size_t i = 0; i < repeats; i++)
+        {
+            std::vector<T> copy = container;
+            copy.erase(std::remove(copy.begin(), copy.end(), static_cast<T>(1)), copy.end());
+        }
+    }
+
+    static void bagEraseValue(size_t amount, size_t repeats)
+    {
+        const std::vector<T> container = values(amount);
+
+        for (size_t i = 0; i < repeats; i++)
+        {
+            BagContainerAdaptor<T, std::vector<T>> adapter;
+            adapter.insert(container.begin(), container.end());
+            adapter.erase(static_cast<T>(1));
+        }
+    }
+
+private:
+    // Every value is between 1 and 100, except for the last one that is 0.
+    static std::vector<T> values(size_t amount)
+    {
+        std::vector<T> result;
+        result.reserve(amount);
+
+        for (size_t i = 0; i + 1 < amount; i++)
+        {
+            result.push_back(static_cast<T>(1 + i % 100));
+        }
+        result.push_back(static_cast<T>(0));
+        return result;
+    }
+};
+
+// Inserting and removing LinkedList nodes with the given node allocator.
+template <typename T, typename Allocator>
+class LinkedListBenchmark
+{
+public:
+    static void insertClear(size_t amount, const T& value)
+    {
+        LinkedList<T, Allocator> list;
+
+        for (size_t round = 0; round < 10; round++)
+        {
+            for (size_t i = 0; i < amount; i++)
+            {
+                list.insert(value);
+            }
+            list.clear();
+        }
+    }
+
+    static void insertErase(size_t amount, const T& value)
+    {
+        LinkedList<T, Allocator> list;
+
+        for (size_t round = 0; round < 10; round++)
+        {
+            for (size_t i = 0; i < amount; i++)
+            {
+                list.insert(value);
+            }
+
+            for (size_t i = 0; i < amount; i++)
+            {
+                list.erase(list.begin());
+            }
+        }
+    }
+};
+
+// Traversing, searching and erasing in order in doubly linked lists with one or many elements per node.
+// The lists are filled through insert(end(), value) that every compared list provides.
+template <typename List>
+class TraversalBenchmark
+{
+public:
+    using value_type = typename List::value_type;
+
+    static void iterate(size_t amount, size_t repeats)
+    {
+        List list = values(amount);
+
+        size_t sum = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            // The list does not change, do not let the sum of one pass be reused.
+            clobberMemory();
+            for (auto& element : list)
+            {
+                sum += static_cast<size_t>(element);
+            }
+        }
+
+        if (sum == 0)
+        {
+            std::cerr << "Unexpected sum of elements!" << std::endl;
+        }
+    }
+
+    static void find(size_t amount, size_t repeats)
+    {
+        List list = values(amount);
+
+        size_t misses = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            clobberMemory();
+            if (std::find(list.begin(), list.end(), static_cast<value_type>(0)) == list.end())
+            {
+                misses++;
+            }
+        }
+
+        if (misses != 0)
+        {
+            std::cerr << "Could not find target from list!" << std::endl;
+        }
+    }
+
+    static void erase(size_t amount, size_t repeats)
+    {
+        for (size_t i = 0; i < repeats; i++)
+        {
+            List list = values(amount);
+
+            for (auto it = list.begin(); it != list.end();)
+            {
+                it = *it == static_cast<value_type>(1) ? list.erase(it) : std::next(it);
+            }
+        }
+    }
+
+private:
+    // Every value is between 1 and 100, except for the last one that is 0.
+    static List values(size_t amount)
+    {
+        List result;
+
+        for (size_t i = 0; i + 1 < amount; i++)
+        {
+            result.insert(result.end(), static_cast<value_type>(1 + i % 100));
+        }
+        result.insert(result.end(), static_cast<value_type>(0));
+        return result;
+    }
+};
+
+// Linking and unlinking elements of an object pool in an intrusive bag against copying them into a std::list bag.
+class IntrusiveBenchmark
+{
+public:
+    struct Element : IntrusiveListHook
+    {
+        bool operator==(const Element& other) const
+        {
+            return m_value == other.m_value;
+        }
+
+        size_t m_value = 0;
+    };
+
+    static void intrusiveInsertErase(size_t amount, size_t repeats)
+    {
+        std::vector<Element> pool(amount);
+        BagContainerAdaptor<Element, IntrusiveList<Element>> adapter;
+
+        for (size_t round = 0; round < repeats; round++)
+        {
+            for (auto& element : pool)
+            {
+                adapter.insert(element);
+            }
+
+            for (auto& element : pool)
+            {
+                adapter.unlink(element);
+            }
+        }
+    }
+
+    static void listInsertErase(size_t amount, size_t repeats)
+    {
+        std::vector<Element> pool(amount);
+        BagContainerAdaptor<Element, std::list<Element>> adapter;
+
+        for (size_t round = 0; round < repeats; round++)
+        {
+            for (const auto& element : pool)
+            {
+                adapter.insert(element);
+            }
+
+            while (!adapter.empty())
+            {
+                adapter.erase(adapter.begin());
+            }
+        }
+    }
+};
+
+// Looking up and erasing elements of a slot map bag through the handles returned by insert.
+class SlotMapBenchmark
+{
+public:
+    static void insertLookupErase(size_t amount, size_t repeats)
+    {
+        for (size_t round = 0; round < repeats; round++)
+        {
+            BagContainerAdaptor<size_t, SlotMap<size_t>> adapter;
+            std::vector<SlotMapHandle> handles;
+            handles.reserve(amount);
+
+            for (size_t i = 0; i < amount; i++)
+            {
+                handles.push_back(adapter.insert(i));
+            }
+
+            size_t sum = 0;
+            for (const auto& handle : handles)
+            {
+                sum += adapter.at(handle);
+            }
+
+            // Erasing every other element first makes later elements move around in the storage.
+            for (size_t i = 0; i < amount; i += 2)
+            {
+                adapter.erase(handles[i]);
+            }
+            for (size_t i = 1; i < amount; i += 2)
+            {
+                adapter.erase(handles[i]);
+            }
+
+            if (sum != amount * (amount - 1) / 2 || !adapter.empty())
+            {
+                std::cerr << "Unexpected contents in slot map bag!" << std::endl;
+            }
+        }
+    }
+};
+
+// Filling and emptying many short lived small bags, where the first insert of a std::vector bag allocates.
+template <typename Container>
+class SmallBagBenchmark
+{
+public:
+    using value_type = typename Container::value_type;
+
+    static void fillAndErase(size_t bags, size_t elements)
+    {
+        size_t total = 0;
+
+        for (size_t bag = 0; bag < bags; bag++)
+        {
+            BagContainerAdaptor<value_type, Container> adapter;
+
+            for (size_t i = 0; i < elements; i++)
+            {
+                adapter.insert(static_cast<value_type>(i));
+            }
+
+            adapter.erase(adapter.find(static_cast<value_type>(0)));
+            total += adapter.size();
+        }
+
+        if (total != bags * (elements - 1))
+        {
+            std::cerr << "Unexpected size of small bag!" << std::endl;
+        }
+    }
+};
+
+// Inserting the same value over and over, which stores one element per copy in every bag except the counted one.
+template <typename Container>
+class DuplicateBagBenchmark
+{
+public:
+    using value_type = typename Container::value_type;
+
+    static void insertAndErase(size_t amount, value_type value)
+    {
+        BagContainerAdaptor<value_type, Container> adapter;
 
         for (size_t i = 0; i < amount; i++)
         {
-            list.insert_after(it, value);
+            adapter.insert(value);
+        }
+
+        if (adapter.count(value) != amount || adapter.erase(value) != amount)
+        {
+            std::cerr << "Unexpected count of duplicates!" << std::endl;
+        }
+    }
+};
+
+// Filling one bag per producer and funneling them all into a single bag.
+template <typename Container>
+class MergeBenchmark
+{
+public:
+    using value_type = typename Container::value_type;
+
+    static void funnel(size_t amount, size_t bags)
+    {
+        std::vector<BagContainerAdaptor<value_type, Container>> producers(bags);
+
+        for (size_t i = 0; i < amount; i++)
+        {
+            producers[i % bags].insert(static_cast<value_type>(i));
+        }
+
+        BagContainerAdaptor<value_type, Container> result;
+        for (auto& producer : producers)
+        {
+            result.merge(std::move(producer));
+        }
+
+        if (result.size() != amount)
+        {
+            std::cerr << "Elements lost in merge!" << std::endl;
         }
     }
+};
 
-    static void erase(size_t amount, T value)
+// Same functions but for std::forward_list.
+template <typename T>
+class ForwardListBenchmark
+{
+public:
+    static void insert(size_t amount, T value)
     {
         std::forward_list<T> list;
         auto it = list.before_begin();
@@ -144,11 +734,15 @@ public:
         {
             list.insert_after(it, value);
         }
+    }
 
-        list.erase_after(it, list.end());
+    static std::forward_list<T> filled(size_t amount, T value)
+    {
+        return std::forward_list<T>(amount, value);
     }
 
-    static void lookup(size_t amount, T target)
+    // The target is the only element that is not default constructed, in the middle of the list.
+    static std::forward_list<T> lookupList(size_t amount, T target)
     {
         std::forward_list<T> list;
         auto it = list.before_begin();
@@ -167,10 +761,30 @@ public:
                 list.insert_after(it, temp);
             }
         }
+        return list;
+    }
+
+    static void erase(std::forward_list<T>& list)
+    {
+        while (!list.empty())
+        {
+            list.erase_after(list.before_begin());
+        }
+    }
 
-        auto found = std::find(list.begin(), list.end(), target);
+    static void lookup(const std::forward_list<T>& list, size_t repeats, T target)
+    {
+        size_t misses = 0;
+        for (size_t i = 0; i < repeats; i++)
+        {
+            clobberMemory();
+            if (std::find(list.begin(), list.end(), target) == list.end())
+            {
+                misses++;
+            }
+        }
 
-        if (found == list.end())
+        if (misses != 0)
         {
             std::cerr << "Could not find target from container!" << std::endl;
         }
@@ -0,0 +1,533 @@
+#ifndef HARNESS_HPP
+#define HARNESS_HPP
+
+#include "allocation_tracker.hpp"
+#include "perf_counters.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Keep the compiler from proving a value unused and removing the work that produced it.
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : "r,m"(value) : "memory");
+#else
+    const volatile char* escaped = reinterpret_cast<const volatile char*>(&value);
+    (void)*escaped;
+#endif
+}
+
+// Keep the compiler from reordering or dropping stores to memory across this point.
+inline void clobberMemory()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __asm__ __volatile__("" : : : "memory");
+#endif
+}
+
+// Order statistics of the per operation times of all repetitions of one benchmark, in nanoseconds.
+struct Statistics
+{
+    double min = 0.0;
+    double median = 0.0;
+    double p95 = 0.0;
+    double p99 = 0.0;
+    double mean = 0.0;
+    double stddev = 0.0;
+};
+
+// Nearest rank percentile of sorted samples, so every reported value is one that was measured.
+inline double percentile(const std::vector<double>& sorted, double fraction)
+{
+    const auto rank = static_cast<std::size_t>(std::ceil(fraction * static_cast<double>(sorted.size())));
+    return sorted[std::min(sorted.size(), std::max<std::size_t>(rank, 1)) - 1];
+}
+
+inline Statistics summarize(std::vector<double> samples)
+{
+    Statistics statistics;
+    if (samples.empty())
+    {
+        return statistics;
+    }
+
+    std::sort(samples.begin(), samples.end());
+    const double count = static_cast<double>(samples.size());
+
+    statistics.min = samples.front();
+    statistics.median = samples.size() % 2 == 1 ? samples[samples.size() / 2]
+                                                 : (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]) / 2.0;
+    statistics.p95 = percentile(samples, 0.95);
+    statistics.p99 = percentile(samples, 0.99);
+    statistics.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / count;
+
+    // Sample standard deviation, zero for a single repetition.
+    double squares = 0.0;
+    for (double sample : samples)
+    {
+        squares += (sample - statistics.mean) * (sample - statistics.mean);
+    }
+    statistics.stddev = samples.size() > 1 ? std::sqrt(squares / (count - 1.0)) : 0.0;
+
+    return statistics;
+}
+
+// One measured benchmark, the allocation statistics are those of the last repetition.
+struct Result
+{
+    std::string section;
+    std::string name;
+    std::size_t operations = 0;
+    std::size_t repetitions = 0;
+    std::size_t elements = 0;
+    Statistics nanosecondsPerOperation;
+    AllocationStatistics allocations;
+
+    // Hardware events per operation, summed over the repetitions, NaN when they were not counted.
+    PerfCounters::Values counters = PerfCounters::missing();
+
+    // Peak live bytes divided by the elements of the section, zero when the section did not give them.
+    double bytesPerElement() const
+    {
+        return elements == 0 ? 0.0 : static_cast<double>(allocations.peakLiveBytes) / static_cast<double>(elements);
+    }
+};
+
+// Runs every benchmark a few times to warm up caches, the allocator and the branch predictors,
+// then times each of the repetitions separately and reports the distribution of nanoseconds per operation.
+// With --counters, hardware events of every repetition are counted as well when the kernel allows it.
+// Usage: ContainerAdaptorBenchmark [--warmup=N] [--repetitions=N] [--filter=TEXT] [--json=FILE] [--csv=FILE] [--counters]
+class Harness
+{
+public:
+    // Read the options, unknown options end the program with the usage.
+    void configure(int argc, char** argv)
+    {
+        configure(argc, argv, [](const std::string&) { return false; }, "");
+    }
+
+    // Read the options, the ones the harness does not know go to `parseExtra`, which returns whether it accepted them.
+    // `extraUsage` lists the extra options for the usage.
+    template <typename Parser>
+    void configure(int argc, char** argv, Parser parseExtra, const std::string& extraUsage)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            const std::string argument = argv[i];
+
+            if (argument == "--counters")
+            {
+                m_counting = true;
+            }
+            else if (!option(argument, "--warmup=", m_warmup) && !option(argument, "--repetitions=", m_repetitions) &&
+                     !option(argument, "--filter=", m_filter) && !option(argument, "--json=", m_jsonPath) &&
+                     !option(argument, "--csv=", m_csvPath) && !parseExtra(argument))
+            {
+                std::cerr << "Usage: " << argv[0] << " [--warmup=N] [--repetitions=N] [--filter=TEXT] [--json=FILE] [--csv=FILE] [--counters]"
+                          << (extraUsage.empty() ? "" : " ") << extraUsage << std::endl;
+                std::exit(EXIT_FAILURE);
+            }
+        }
+
+        m_repetitions = std::max<std::size_t>(m_repetitions, 1);
+
+        std::string error;
+        if (m_counting && !m_counters.open(error))
+        {
+            std::cerr << "Hardware counters disabled, " << error << ". Lowering /proc/sys/kernel/perf_event_paranoid may allow them." << std::endl;
+            m_counting = false;
+        }
+    }
+
+    // Start a group of benchmarks, the name is the first column of the results.
+    // `elements` is how many elements the benchmarked bags hold at most, used for the bytes per element.
+    void section(const std::string& name, std::size_t elements = 0)
+    {
+        if (!m_section.empty() && m_printed)
+        {
+            std::cout << std::endl;
+        }
+        m_section = name;
+        m_elements = elements;
+        m_printed = false;
+    }
+
+    // Time the callback, where one call performs `operations` operations of the benchmarked kind.
+    template <typename CallBackType, typename... Args>
+    void run(const std::string& name, std::size_t operations, CallBackType callback, Args&&... args)
+    {
+        measure(name, operations, [] { return 0; }, [&](int) { callback(args...); });
+    }
+
+    // Time the callback on a fixture that `setup` returns before every call, where one call performs `operations` operations.
+    // The fixture is built before the clock starts and before the AllocationTracker is reset, so only the work of the callback is
+    // reported. `callback` takes the fixture by reference and may change it, every call gets a new one.
+    template <typename Setup, typename CallBackType>
+    void runWithFixture(const std::string& name, std::size_t operations, Setup setup, CallBackType callback)
+    {
+        measure(name, operations, setup, callback);
+    }
+
+    // Report nanoseconds the caller measured itself, such as the latencies of single operations.
+    // Each sample counts as one operation of one repetition.
+    void record(const std::string& name, std::vector<double> nanoseconds)
+    {
+        if (!selected(name))
+        {
+            return;
+        }
+
+        if (!m_printed)
+        {
+            std::cout << m_section << std::endl;
+            m_printed = true;
+        }
+
+        Result result;
+        result.section = m_section;
+        result.name = name;
+        result.operations = 1;
+        result.repetitions = nanoseconds.size();
+        result.elements = m_elements;
+        result.nanosecondsPerOperation = summarize(std::move(nanoseconds));
+        print(result);
+        m_results.push_back(result);
+    }
+
+    // Keep a result measured elsewhere for the reports, without printing it.
+    void add(Result result)
+    {
+        m_results.push_back(std::move(result));
+    }
+
+    // Whether run or record would measure a benchmark of this name in the current section.
+    bool selected(const std::string& name) const
+    {
+        return m_filter.empty() || (m_section + " " + name).find(m_filter) != std::string::npos;
+    }
+
+    // Write the machine-readable reports that were asked for.
+    void finish() const
+    {
+        if (!m_jsonPath.empty())
+        {
+            std::ofstream file(m_jsonPath);
+            writeJson(file);
+        }
+        if (!m_csvPath.empty())
+        {
+            std::ofstream file(m_csvPath);
+            writeCsv(file);
+        }
+    }
+
+    void writeJson(std::ostream& out) const
+    {
+        out << "{\n  \"warmup\": " << m_warmup << ",\n  \"repetitions\": " << m_repetitions << ",\n  \"benchmarks\": [";
+
+        for (std::size_t i = 0; i < m_results.size(); i++)
+        {
+            const Result& result = m_results[i];
+            const Statistics& ns = result.nanosecondsPerOperation;
+            const AllocationStatistics& memory = result.allocations;
+
+            out << (i == 0 ? "\n" : ",\n") << "    {\"section\": " << quoted(result.section) << ", \"name\": " << quoted(result.name)
+                << ", \"operations\": " << result.operations << ", \"repetitions\": " << result.repetitions
+                << ", \"ns_per_op\": {\"min\": " << ns.min << ", \"median\": " << ns.median << ", \"p95\": " << ns.p95
+                << ", \"p99\": " << ns.p99 << ", \"mean\": " << ns.mean << ", \"stddev\": " << ns.stddev << "}"
+                << ", \"elements\": " << result.elements << ", \"allocations\": " << memory.allocations
+                << ", \"deallocations\": " << memory.deallocations << ", \"allocated_bytes\": " << memory.allocatedBytes
+                << ", \"freed_bytes\": " << memory.freedBytes << ", \"peak_live_bytes\": " << memory.peakLiveBytes
+                << ", \"bytes_per_element\": " << result.bytesPerElement() << ", \"counters_per_op\": {";
+            for (std::size_t counter = 0; counter < PerfCounters::Count; counter++)
+            {
+                out << (counter == 0 ? "" : ", ") << '"' << PerfCounters::name(counter) << "\": ";
+                if (std::isnan(result.counters[counter]))
+                {
+                    out << "null";
+                }
+                else
+                {
+                    out << result.counters[counter];
+                }
+            }
+            out << "}}";
+        }
+
+        out << "\n  ]\n}\n";
+    }
+
+    void writeCsv(std::ostream& out) const
+    {
+        out << "section,name,operations,repetitions,min_ns,median_ns,p95_ns,p99_ns,mean_ns,stddev_ns,"
+            << "elements,allocations,deallocations,allocated_bytes,freed_bytes,peak_live_bytes,bytes_per_element";
+        for (std::size_t counter = 0; counter < PerfCounters::Count; counter++)
+        {
+            out << ',' << PerfCounters::name(counter) << "_per_op";
+        }
+        out << '\n';
+
+        for (const Result& result : m_results)
+        {
+            const Statistics& ns = result.nanosecondsPerOperation;
+            const AllocationStatistics& memory = result.allocations;
+
+            out << csvField(result.section) << ',' << csvField(result.name) << ',' << result.operations << ',' << result.repetitions
+                << ',' << ns.min << ',' << ns.median << ',' << ns.p95 << ',' << ns.p99 << ',' << ns.mean << ',' << ns.stddev
+                << ',' << result.elements << ',' << memory.allocations << ',' << memory.deallocations << ',' << memory.allocatedBytes
+                << ',' << memory.freedBytes << ',' << memory.peakLiveBytes << ',' << result.bytesPerElement();
+            for (double value : result.counters)
+            {
+                out << ',';
+                if (!std::isnan(value))
+                {
+                    out << value;
+                }
+            }
+            out << '\n';
+        }
+    }
+
+    const std::vector<Result>& results() const noexcept
+    {
+        return m_results;
+    }
+
+    std::size_t warmup() const noexcept
+    {
+        return m_warmup;
+    }
+
+    std::size_t repetitions() const noexcept
+    {
+        return m_repetitions;
+    }
+
+    // Parsers of `--name=value` arguments, false when the argument is another option or the value is malformed.
+    static bool option(const std::string& argument, const std::string& prefix, std::string& value)
+    {
+        if (argument.compare(0, prefix.size(), prefix) != 0)
+        {
+            return false;
+        }
+        value = argument.substr(prefix.size());
+        return true;
+    }
+
+    static bool option(const std::string& argument, const std::string& prefix, std::size_t& value)
+    {
+        std::string text;
+        if (!option(argument, prefix, text) || text.empty() || text.find_first_not_of("0123456789") != std::string::npos)
+        {
+            return false;
+        }
+        value = static_cast<std::size_t>(std::stoull(text));
+        return true;
+    }
+
+    static bool option(const std::string& argument, const std::string& prefix, double& value)
+    {
+        std::string text;
+        if (!option(argument, prefix, text) || text.empty())
+        {
+            return false;
+        }
+
+        char* end = nullptr;
+        const double parsed = std::strtod(text.c_str(), &end);
+        if (*end != '\0' || !std::isfinite(parsed))
+        {
+            return false;
+        }
+        value = parsed;
+        return true;
+    }
+
+private:
+    template <typename Setup, typename CallBackType>
+    void measure(const std::string& name, std::size_t operations, Setup setup, CallBackType callback)
+    {
+        if (!selected(name))
+        {
+            return;
+        }
+
+        if (!m_printed)
+        {
+            std::cout << m_section << std::endl;
+            m_printed = true;
+        }
+
+        for (std::size_t i = 0; i < m_warmup; i++)
+        {
+            auto fixture = setup();
+            callback(fixture);
+        }
+
+        Result result;
+        result.section = m_section;
+        result.name = name;
+        result.operations = std::max<std::size_t>(operations, 1);
+        result.repetitions = m_repetitions;
+        result.elements = m_elements;
+
+        std::vector<double> samples;
+        samples.reserve(m_repetitions);
+
+        PerfCounters::Values events;
+        events.fill(0.0);
+
+        for (std::size_t i = 0; i < m_repetitions; i++)
+        {
+            auto fixture = setup();
+            AllocationTracker::reset();
+
+            if (m_counting)
+            {
+                m_counters.start();
+            }
+            clobberMemory();
+            const auto begin = std::chrono::steady_clock::now();
+            callback(fixture);
+            const auto end = std::chrono::steady_clock::now();
+            clobberMemory();
+            if (m_counting)
+            {
+                m_counters.stop();
+                const PerfCounters::Values counted = m_counters.read();
+                for (std::size_t counter = 0; counter < PerfCounters::Count; counter++)
+                {
+                    events[counter] += counted[counter];
+                }
+            }
+
+            // Taken before the fixture is destroyed, so freeing it is not counted.
+            result.allocations = AllocationTracker::statistics();
+
+            const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+            samples.push_back(static_cast<double>(elapsed) / static_cast<double>(result.operations));
+        }
+
+        result.nanosecondsPerOperation = summarize(std::move(samples));
+        if (m_counting)
+        {
+            const double total = static_cast<double>(result.operations) * static_cast<double>(result.repetitions);
+            for (std::size_t counter = 0; counter < PerfCounters::Count; counter++)
+            {
+                result.counters[counter] = events[counter] / total;
+            }
+        }
+        print(result);
+        m_results.push_back(result);
+    }
+
+    static std::string quoted(const std::string& text)
+    {
+        std::ostringstream out;
+        out << '"';
+        for (char c : text)
+        {
+            if (c == '"' || c == '\\')
+            {
+                out << '\\' << c;
+            }
+            else if (static_cast<unsigned char>(c) < 0x20)
+            {
+                out << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+            }
+            else
+            {
+                out << c;
+            }
+        }
+        out << '"';
+        return out.str();
+    }
+
+    static std::string csvField(const std::string& text)
+    {
+        if (text.find_first_of(",\"\n") == std::string::npos)
+        {
+            return text;
+        }
+
+        std::string field = "\"";
+        for (char c : text)
+        {
+            field += c == '"' ? std::string("\"\"") : std::string(1, c);
+        }
+        return field + "\"";
+    }
+
+    void print(const Result& result) const
+    {
+        const Statistics& ns = result.nanosecondsPerOperation;
+        const AllocationStatistics& memory = result.allocations;
+        const auto precision = std::cout.precision();
+
+        std::cout << std::fixed << std::setprecision(2) << result.name << ": median " << ns.median << " ns/op"
+                  << " (min " << ns.min << ", p95 " << ns.p95 << ", p99 " << ns.p99 << ", stddev " << ns.stddev << ")"
+                  << " over " << result.repetitions << " x " << result.operations << " operations. "
+                  << "Allocations: " << memory.allocations << " (" << memory.allocatedBytes << " bytes), frees: " << memory.deallocations
+                  << " (" << memory.freedBytes << " bytes), peak live: " << memory.peakLiveBytes << " bytes";
+        if (result.elements != 0)
+        {
+            std::cout << ", " << result.bytesPerElement() << " bytes per element";
+        }
+        std::cout << "." << std::endl;
+
+        if (!std::isnan(result.counters[PerfCounters::Cycles]) || !std::isnan(result.counters[PerfCounters::Instructions]))
+        {
+            std::cout << "    Per operation:";
+            for (std::size_t counter = 0; counter < PerfCounters::Count; counter++)
+            {
+                std::cout << (counter == 0 ? " " : ", ") << PerfCounters::name(counter) << " ";
+                if (std::isnan(result.counters[counter]))
+                {
+                    std::cout << "n/a";
+                }
+                else
+                {
+                    std::cout << result.counters[counter];
+                }
+            }
+            const double ipc = result.counters[PerfCounters::Instructions] / result.counters[PerfCounters::Cycles];
+            if (!std::isnan(ipc) && !std::isinf(ipc))
+            {
+                std::cout << ", IPC " << ipc;
+            }
+            std::cout << "." << std::endl;
+        }
+        std::cout.unsetf(std::ios::floatfield);
+        std::cout.precision(precision);
+    }
+
+    std::size_t m_warmup = 1;
+    std::size_t m_repetitions = 10;
+    std::string m_filter;
+    std::string m_jsonPath;
+    std::string m_csvPath;
+
+    std::string m_section;
+    std::size_t m_elements = 0;
+    bool m_printed = false;
+    std::vector<Result> m_results;
+
+    bool m_counting = false;
+    PerfCounters m_counters;
+};
+
+#endif
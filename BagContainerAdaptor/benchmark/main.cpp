@@ -1,59 +1,72 @@
 #include "benchmark.hpp"
 #include "custom_type.hpp"
+#include "harness.hpp"
+#include "sweep.hpp"
 
 #include <unordered_map>
 
-long memoryUsage = 0;
+Harness harness;
 
-// Overloading new and delete operators globally to track memory usage.
-void* operator new(size_t size)
+// Time the benchmark with the harness, `operations` is the amount of operations one call of the callback performs.
+template <typename CallBackType, typename... Args>
+void run(const std::string& name, std::size_t operations, CallBackType callback, Args&&... args)
 {
-    void* ptr = malloc(size);
-    if (ptr != nullptr)
-    {
-        memoryUsage += size;
-    }
-    return ptr;
+    harness.run(name, operations, callback, std::forward<Args>(args)...);
 }
 
-void operator delete(void* ptr) noexcept
+// Time only the callback on a fixture that `setup` builds before every call, see Harness::runWithFixture.
+template <typename Setup, typename CallBackType>
+void runWithFixture(const std::string& name, std::size_t operations, Setup setup, CallBackType callback)
 {
-    if (ptr != nullptr)
-    {
-        free(ptr);
-    }
+    harness.runWithFixture(name, operations, setup, callback);
 }
 
-// Test runner function to track the time it takes to run the benchmarks.
-template <typename CallBackType, typename... Args>
-void run(const std::string& name, CallBackType callback, Args&&... args)
-{
-    auto begin = std::chrono::steady_clock::now();
-    callback(std::forward<Args>(args)...);
-    auto end = std::chrono::steady_clock::now();
-
-    std::cout << name << " took: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << " nanoseconds. ";
-    std::cout << "Allocations: " << memoryUsage << " bytes." << std::endl;
-    memoryUsage = 0;
-}
+// How many times the lookup and back benchmarks repeat their operation on the same bag.
+const size_t lookupRepeats = 100;
 
 // Run insert, remove and lookup for BagContainerAdapter and the underlying type.
+// The erase, back and lookup benchmarks get a filled bag or container from the harness, so only the named operation is timed.
 template <typename Container>
 class BenchmarkRunner
 {
 public:
     using value_type = typename Container::value_type;
+    using Bag = BagContainerAdaptor<value_type, Container>;
 
     static void runBenchmarks(size_t amount, const value_type& value, const value_type& target)
     {
-        Benchmark<Container> benchmark;
-
-        run("Container insert", benchmark.containerInsert, amount, value);
-        run("Bag insert", benchmark.bagInsert, amount, value);
-        run("Container erase", benchmark.containerErase, amount, value);
-        run("Bag erase", benchmark.bagErase, amount, value);
-        run("Container lookup", benchmark.containerLookup, amount, target);
-        run("Bag lookup", benchmark.bagLookup, amount, target);
+        using B = Benchmark<Container>;
+
+        run("Container insert", amount, B::containerInsert, amount, value);
+        run("Bag insert", amount, B::bagInsert, amount, value);
+        run("Bag insert copy of temporary", amount, B::bagInsertCopy, amount, value);
+        run("Bag insert move of temporary", amount, B::bagInsertMove, amount, value);
+        run("Bag emplace", amount, B::bagEmplace, amount, value);
+        runWithFixture("Bag range insert", amount, [&] { return B::range(amount, value); }, B::bagInsertRange);
+        runWithFixture("Container erase", amount, [&] { return B::filledContainer(amount, value); }, B::containerErase);
+        runWithFixture("Bag erase", amount, [&] { return B::filledBag(amount, value); }, B::bagErase);
+        runBagBenchmarks(amount, value);
+        runWithFixture("Container lookup", lookupRepeats, [&] { return B::lookupContainer(amount, target); },
+                       [&](const Container& container) { B::containerLookup(container, lookupRepeats, target); });
+        runBagLookup(amount, target);
+    }
+
+    static void runBagLookup(size_t amount, const value_type& target)
+    {
+        using B = Benchmark<Container>;
+
+        runWithFixture("Bag lookup", lookupRepeats, [&] { return B::lookupBag(amount, target); },
+                       [&](const Bag& adapter) { B::bagLookup(adapter, lookupRepeats, target); });
+    }
+
+    // The back and erase benchmarks of the bag alone, shared with ForwardListRunner.
+    static void runBagBenchmarks(size_t amount, const value_type& value)
+    {
+        using B = Benchmark<Container>;
+
+        runWithFixture("Bag back", amount, [&] { return B::filledBag(amount, value); }, [&](Bag& adapter) { B::bagBack(adapter, amount, value); });
+        runWithFixture("Bag erase value", 1, [&] { return B::halfFilledBag(amount, value); }, [&](Bag& adapter) { B::bagEraseValue(adapter, value); });
+        runWithFixture("Bag erase if", 1, [&] { return B::halfFilledBag(amount, value); }, [&](Bag& adapter) { B::bagEraseIf(adapter, value); });
     }
 };
 
@@ -64,99 +77,244 @@ class ForwardListRunner
 public:
     static void runBenchmarks(size_t amount, const T& value, const T& target)
     {
-        ForwardListBenchmark<T> forwardListBenchmark;
-        Benchmark<std::forward_list<T>> benchmark;
-
-        run("Container insert", forwardListBenchmark.insert, amount, value);
-        run("Bag insert", benchmark.bagInsert, amount, value);
-        run("Container erase", forwardListBenchmark.erase, amount, value);
-        run("Bag erase", benchmark.bagErase, amount, value);
-        run("Container lookup", forwardListBenchmark.lookup, amount, target);
-        run("Bag lookup", benchmark.bagLookup, amount, target);
+        using F = ForwardListBenchmark<T>;
+        using B = Benchmark<std::forward_list<T>>;
+
+        run("Container insert", amount, F::insert, amount, value);
+        run("Bag insert", amount, B::bagInsert, amount, value);
+        run("Bag insert copy of temporary", amount, B::bagInsertCopy, amount, value);
+        run("Bag insert move of temporary", amount, B::bagInsertMove, amount, value);
+        run("Bag emplace", amount, B::bagEmplace, amount, value);
+        runWithFixture("Bag range insert", amount, [&] { return B::range(amount, value); }, B::bagInsertRange);
+        runWithFixture("Container erase", amount, [&] { return F::filled(amount, value); }, F::erase);
+        runWithFixture("Bag erase", amount, [&] { return B::filledBag(amount, value); }, B::bagErase);
+        BenchmarkRunner<std::forward_list<T>>::runBagBenchmarks(amount, value);
+        runWithFixture("Container lookup", lookupRepeats, [&] { return F::lookupList(amount, target); },
+                       [&](const std::forward_list<T>& list) { F::lookup(list, lookupRepeats, target); });
+        BenchmarkRunner<std::forward_list<T>>::runBagLookup(amount, target);
     }
 };
 
 // Run all the benchmarks for all the required types.
 template <typename T>
-void runBenchmarks(size_t amount, const T& value, const T& target)
+void runBenchmarks(const std::string& type, size_t amount, const T& value, const T& target)
 {
-    std::cout << "std::vector\n";
+    harness.section(type + ", std::vector", amount);
     BenchmarkRunner<std::vector<T>>::runBenchmarks(amount, value, target);
-    std::cout << "\n";
 
-    std::cout << "std::deque\n";
+    harness.section(type + ", std::deque", amount);
     BenchmarkRunner<std::deque<T>>::runBenchmarks(amount, value, target);
-    std::cout << "\n";
 
-    std::cout << "std::list\n";
+    harness.section(type + ", std::list", amount);
     BenchmarkRunner<std::list<T>>::runBenchmarks(amount, value, target);
-    std::cout << "\n";
 
-    std::cout << "std::forward_list\n";
+    harness.section(type + ", LinkedList", amount);
+    BenchmarkRunner<LinkedList<T>>::runBenchmarks(amount, value, target);
+
+    harness.section(type + ", std::forward_list", amount);
     ForwardListRunner<T>::runBenchmarks(amount, value, target);
-    std::cout << "\n";
 
-    std::cout << "std::multiset\n";
+    harness.section(type + ", std::multiset", amount);
     BenchmarkRunner<std::multiset<T>>::runBenchmarks(amount, value, target);
-    std::cout << "\n";
 
-    std::cout << "unordered_multiset\n";
+    harness.section(type + ", unordered_multiset", amount);
     BenchmarkRunner<std::unordered_multiset<T>>::runBenchmarks(amount, value, target);
-    std::cout << "\n";
+
+    harness.section(type + ", IndexedVector", amount);
+    BenchmarkRunner<IndexedVector<T>>::runBenchmarks(amount, value, target);
+
+    harness.section(type + ", SmallVector, 16 inline elements", amount);
+    BenchmarkRunner<SmallVector<T, 16>>::runBenchmarks(amount, value, target);
+
+    harness.section(type + ", UnrolledLinkedList", amount);
+    BenchmarkRunner<UnrolledLinkedList<T>>::runBenchmarks(amount, value, target);
+}
+
+// Erase the 1000 distinct values of 1000000 elements, one operation per erased value.
+template <typename Container>
+void runBagEraseValue()
+{
+    using E = EraseValueBenchmark<Container>;
+
+    runWithFixture("Bag erase value", 1000, [] { return E::filledBag(1000000, 1000); },
+                   [](BagContainerAdaptor<typename Container::value_type, Container>& adapter) { E::bagEraseValue(adapter, 1000); });
+}
+
+template <typename Container>
+void runContainerAndBagEraseValue()
+{
+    using E = EraseValueBenchmark<Container>;
+
+    runWithFixture("Container erase value", 1000, [] { return E::filledContainer(1000000, 1000); },
+                   [](Container& container) { E::containerEraseValue(container, 1000); });
+    runBagEraseValue<Container>();
+}
+
+// Compare erasing by value through the bag against the erase(key) of the associative containers.
+void runEraseValueBenchmarks()
+{
+    harness.section("std::multiset<int> erase by value", 1000000);
+    runContainerAndBagEraseValue<std::multiset<int>>();
+
+    harness.section("std::unordered_multiset<int> erase by value", 1000000);
+    runContainerAndBagEraseValue<std::unordered_multiset<int>>();
+
+    harness.section("std::vector<int> bag erase by value", 1000000);
+    runBagEraseValue<std::vector<int>>();
+
+    harness.section("IndexedVector<int> erase by value", 1000000);
+    runContainerAndBagEraseValue<IndexedVector<int>>();
 }
 
 void runExtraBenchmarks()
 {
-    std::cout << "std::vector<int>" << std::endl;
+    harness.section("std::vector<int>", 100000);
     BenchmarkRunner<std::vector<int>>::runBenchmarks(100000, 3310, 323);
-    std::cout << std::endl;
 
-    std::cout << "std::vector<CustomType>" << std::endl;
+    harness.section("std::vector<CustomType>", 100);
     BenchmarkRunner<std::vector<CustomType>>::runBenchmarks(100, CustomType(), CustomType());
-    std::cout << std::endl;
 
-    std::cout << "std::vector<std::vector<std::string>>>" << std::endl;
+    harness.section("std::vector<std::vector<std::string>>>", 1000);
     BenchmarkRunner<std::vector<std::vector<std::string>>>::runBenchmarks(1000, std::vector<std::string>{"hello", "how", "are", "you"}, std::vector<std::string>{"hey"});
-    std::cout << std::endl;
 
-    std::cout << "std::list<int>" << std::endl;
+    harness.section("std::list<int>", 100000);
     BenchmarkRunner<std::list<int>>::runBenchmarks(100000, 323254, 311);
-    std::cout << std::endl;
 
-    std::cout << "std::list<std::unordered_map<int, std::string>>" << std::endl;
+    harness.section("std::list<std::unordered_map<int, std::string>>", 100000);
     BenchmarkRunner<std::list<std::unordered_map<int, std::string>>>::runBenchmarks(100000, std::unordered_map<int, std::string>{{1, "one"}, {2, "two"}, {3, "three"}},
                                                                                     std::unordered_map<int, std::string>{{66, "moi"}});
-    std::cout << std::endl;
 
-    std::cout << "std::deque<size_t>" << std::endl;
+    harness.section("std::deque<size_t>", 100000);
     BenchmarkRunner<std::deque<size_t>>::runBenchmarks(100000, std::numeric_limits<size_t>::max(), 543543);
-    std::cout << std::endl;
 
-    std::cout << "std::deque<std::vector<std::vector<int>>>" << std::endl;
+    harness.section("std::deque<std::vector<std::vector<int>>>", 100000);
     BenchmarkRunner<std::deque<std::vector<std::vector<int>>>>::runBenchmarks(100000, std::vector<std::vector<int>>{std::vector<int>{4, 2}, std::vector<int>{5, 8}},
                                                                               std::vector<std::vector<int>>{std::vector<int>{363}});
-    std::cout << std::endl;
 
-    std::cout << "std::multiset<int>" << std::endl;
+    harness.section("std::multiset<int>", 1000000);
     BenchmarkRunner<std::multiset<int>>::runBenchmarks(1000000, 1, 65656);
-    std::cout << std::endl;
 
-    std::cout << "std::multiset<std::list<std::string>>" << std::endl;
+    harness.section("std::multiset<std::list<std::string>>", 10000);
     BenchmarkRunner<std::multiset<std::list<std::string>>>::runBenchmarks(10000, std::list<std::string>{"hey"}, std::list<std::string>{"hey hey"});
-    std::cout << std::endl;
 }
 
-int main()
+// Compare find, count and erase by value of contiguous bags of arithmetic types against the scalar algorithms.
+template <typename T>
+void runSearchBenchmarks(const std::string& name)
+{
+    for (size_t amount = 10000; amount <= 10000000; amount *= 10)
+    {
+        // Keep the amount of compared elements the same for every size.
+        const size_t repeats = 100000000 / amount;
+
+        harness.section("std::vector<" + name + ">, " + std::to_string(amount) + " elements, " + std::to_string(repeats) + " repeats", amount);
+        run("Container find", amount * repeats, SearchBenchmark<T>::containerFind, amount, repeats);
+        run("Bag find", amount * repeats, SearchBenchmark<T>::bagFind, amount, repeats);
+        run("Container count", amount * repeats, SearchBenchmark<T>::containerCount, amount, repeats);
+        run("Bag count", amount * repeats, SearchBenchmark<T>::bagCount, amount, repeats);
+        run("Container remove-erase value", amount * (repeats / 10), SearchBenchmark<T>::containerEraseValue, amount, repeats / 10);
+        run("Bag erase value", amount * (repeats / 10), SearchBenchmark<T>::bagEraseValue, amount, repeats / 10);
+    }
+}
+
+// Compare the node containers with PoolAllocator against std::allocator.
+void runAllocatorBenchmarks()
+{
+    harness.section("LinkedList<int>, std::allocator", 100000);
+    run("Insert and clear", 100000, LinkedListBenchmark<int, std::allocator<LinkedListNode<int>>>::insertClear, 100000, 1);
+    run("Insert and erase", 100000, LinkedListBenchmark<int, std::allocator<LinkedListNode<int>>>::insertErase, 100000, 1);
+
+    harness.section("LinkedList<int>, PoolAllocator", 100000);
+    run("Insert and clear", 100000, LinkedListBenchmark<int, PoolAllocator<LinkedListNode<int>>>::insertClear, 100000, 1);
+    run("Insert and erase", 100000, LinkedListBenchmark<int, PoolAllocator<LinkedListNode<int>>>::insertErase, 100000, 1);
+
+    harness.section("std::list<int, PoolAllocator<int>>", 100000);
+    BenchmarkRunner<std::list<int, PoolAllocator<int>>>::runBenchmarks(100000, 5, 6);
+
+    harness.section("std::multiset<int, std::less<int>, PoolAllocator<int>>", 100000);
+    BenchmarkRunner<std::multiset<int, std::less<int>, PoolAllocator<int>>>::runBenchmarks(100000, 5, 6);
+}
+
+// Compare traversal of the unrolled list against the lists with one element per node.
+template <typename List>
+void runTraversalBenchmarks(const std::string& name, size_t amount, size_t repeats)
+{
+    harness.section(name + ", " + std::to_string(amount) + " elements, " + std::to_string(repeats) + " repeats", amount);
+    run("Iterate", amount * repeats, TraversalBenchmark<List>::iterate, amount, repeats);
+    run("Find", amount * repeats, TraversalBenchmark<List>::find, amount, repeats);
+    run("Erase in order", amount * (repeats / 10), TraversalBenchmark<List>::erase, amount, repeats / 10);
+}
+
+// Time the operations of every backend over a geometric range of sizes instead of the fixed sizes of the other benchmarks.
+void runSweep(const SweepOptions& options)
 {
-    std::cout << "int, 10000 iterations\n";
-    runBenchmarks<int>(10000, 5, 6);
-    std::cout << "\n";
+    Sweep sweep(harness, options);
+
+    sweep.add<std::vector<int>>("std::vector");
+    sweep.add<std::deque<int>>("std::deque");
+    sweep.add<std::list<int>>("std::list");
+    sweep.add<LinkedList<int>>("LinkedList");
+    sweep.add<std::forward_list<int>>("std::forward_list");
+    sweep.add<std::multiset<int>>("std::multiset");
+    sweep.add<std::unordered_multiset<int>>("std::unordered_multiset");
+    sweep.add<IndexedVector<int>>("IndexedVector");
+    sweep.add<SmallVector<int, 16>>("SmallVector, 16 inline elements");
+    sweep.add<UnrolledLinkedList<int>>("UnrolledLinkedList");
+    sweep.add<CountedMultiset<int>>("CountedMultiset");
+
+    sweep.report();
+}
+
+int main(int argc, char** argv)
+{
+    SweepOptions sweep;
+    harness.configure(argc, argv, [&sweep](const std::string& argument) { return sweep.parse(argument); }, SweepOptions::usage());
+
+    if (sweep.enabled)
+    {
+        runSweep(sweep);
+        harness.finish();
+        return 0;
+    }
 
-    std::cout << "double, 10000\n";
-    runBenchmarks<double>(10000, 0.2, 0.5);
-    std::cout << "\n";
+    runBenchmarks<int>("int, 10000 elements", 10000, 5, 6);
+    runBenchmarks<double>("double, 10000 elements", 10000, 0.2, 0.5);
 
     runExtraBenchmarks();
 
+    runEraseValueBenchmarks();
+
+    runSearchBenchmarks<int>("int");
+    runSearchBenchmarks<double>("double");
+    runSearchBenchmarks<size_t>("size_t");
+
+    runAllocatorBenchmarks();
+
+    runTraversalBenchmarks<LinkedList<int>>("LinkedList<int>", 1000000, 100);
+    runTraversalBenchmarks<std::list<int>>("std::list<int>", 1000000, 100);
+    runTraversalBenchmarks<UnrolledLinkedList<int>>("UnrolledLinkedList<int>", 1000000, 100);
+
+    harness.section("Object pool, 100000 elements, 100 repeats", 100000);
+    run("Intrusive bag insert and erase", 100000 * 100, IntrusiveBenchmark::intrusiveInsertErase, 100000, 100);
+    run("std::list bag insert and erase", 100000 * 100, IntrusiveBenchmark::listInsertErase, 100000, 100);
+
+    harness.section("1000000 bags of 12 ints", 12);
+    run("std::vector bag", 1000000 * 12, SmallBagBenchmark<std::vector<int>>::fillAndErase, 1000000, 12);
+    run("SmallVector<int, 16> bag", 1000000 * 12, SmallBagBenchmark<SmallVector<int, 16>>::fillAndErase, 1000000, 12);
+
+    harness.section("The same int inserted 1000000 times", 1000000);
+    run("std::vector bag", 1000000, DuplicateBagBenchmark<std::vector<int>>::insertAndErase, 1000000, 5);
+    run("std::unordered_multiset bag", 1000000, DuplicateBagBenchmark<std::unordered_multiset<int>>::insertAndErase, 1000000, 5);
+    run("CountedMultiset bag", 1000000, DuplicateBagBenchmark<CountedMultiset<int>>::insertAndErase, 1000000, 5);
+
+    harness.section("1000000 ints in 64 bags merged into one", 1000000);
+    run("std::vector bag", 1000000, MergeBenchmark<std::vector<int>>::funnel, 1000000, 64);
+    run("std::list bag", 1000000, MergeBenchmark<std::list<int>>::funnel, 1000000, 64);
+    run("LinkedList bag", 1000000, MergeBenchmark<LinkedList<int>>::funnel, 1000000, 64);
+
+    harness.section("SlotMap<size_t>, 100000 elements, 100 repeats", 100000);
+    run("Insert, look up and erase by handle", 100000 * 100, SlotMapBenchmark::insertLookupErase, 100000, 100);
+
+    harness.finish();
     return 0;
 }
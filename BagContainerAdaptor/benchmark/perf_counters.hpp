@@ -0,0 +1,182 @@
+#ifndef PERF_COUNTERS_HPP
+#define PERF_COUNTERS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// Hardware events of the calling thread through Linux perf_event_open, counted in user space only.
+// Every counter is opened on its own, so a counter the processor or the kernel does not offer leaves the others working.
+// On other systems, or when perf_event_paranoid denies access, open fails and the benchmarks run without counters.
+class PerfCounters
+{
+public:
+    enum Counter : std::size_t
+    {
+        Cycles,
+        Instructions,
+        L1DataMisses,
+        LastLevelCacheMisses,
+        BranchMisses,
+        DataTlbMisses,
+        Count
+    };
+
+    using Values = std::array<double, Count>;
+
+    PerfCounters()
+    {
+        m_descriptors.fill(-1);
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    ~PerfCounters()
+    {
+        close();
+    }
+
+    // The names used in the reports.
+    static const char* name(std::size_t counter)
+    {
+        static const char* const names[Count] = {"cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses", "dtlb_misses"};
+        return names[counter];
+    }
+
+    // Values of counters that were not measured.
+    static Values missing()
+    {
+        Values values;
+        values.fill(std::numeric_limits<double>::quiet_NaN());
+        return values;
+    }
+
+    // Open the counters, false with the reason in `error` when none of them could be opened.
+    bool open(std::string& error)
+    {
+#ifdef __linux__
+        const std::uint64_t cacheReadMiss =
+            (static_cast<std::uint64_t>(PERF_COUNT_HW_CACHE_OP_READ) << 8) | (static_cast<std::uint64_t>(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+
+        const std::uint32_t types[Count] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE,
+                                            PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE};
+        const std::uint64_t configs[Count] = {PERF_COUNT_HW_CPU_CYCLES,    PERF_COUNT_HW_INSTRUCTIONS,
+                                              PERF_COUNT_HW_CACHE_L1D | cacheReadMiss, PERF_COUNT_HW_CACHE_MISSES,
+                                              PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_DTLB | cacheReadMiss};
+
+        bool opened = false;
+        for (std::size_t counter = 0; counter < Count; counter++)
+        {
+            perf_event_attr attributes;
+            std::memset(&attributes, 0, sizeof(attributes));
+            attributes.size = sizeof(attributes);
+            attributes.type = types[counter];
+            attributes.config = configs[counter];
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            // This thread on any processor.
+            m_descriptors[counter] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+            if (m_descriptors[counter] >= 0)
+            {
+                opened = true;
+            }
+            else if (error.empty())
+            {
+                error = std::string("perf_event_open: ") + std::strerror(errno);
+            }
+        }
+
+        if (opened)
+        {
+            error.clear();
+        }
+        return opened;
+#else
+        error = "hardware counters need Linux perf_event_open";
+        return false;
+#endif
+    }
+
+    // Zero and enable the counters.
+    void start()
+    {
+#ifdef __linux__
+        for (int descriptor : m_descriptors)
+        {
+            if (descriptor >= 0)
+            {
+                ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+                ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+            }
+        }
+#endif
+    }
+
+    void stop()
+    {
+#ifdef __linux__
+        for (int descriptor : m_descriptors)
+        {
+            if (descriptor >= 0)
+            {
+                ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+#endif
+    }
+
+    // Counts between start and stop, NaN for counters that are not open.
+    // When the kernel had more events than hardware counters, a count is scaled up by the share of the time it ran.
+    Values read() const
+    {
+        Values values = missing();
+#ifdef __linux__
+        for (std::size_t counter = 0; counter < Count; counter++)
+        {
+            std::uint64_t data[3] = {0, 0, 0};
+            if (m_descriptors[counter] < 0 || ::read(m_descriptors[counter], data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)))
+            {
+                continue;
+            }
+
+            const double value = static_cast<double>(data[0]);
+            values[counter] = data[2] == 0 ? 0.0 : value * static_cast<double>(data[1]) / static_cast<double>(data[2]);
+        }
+#endif
+        return values;
+    }
+
+private:
+    void close()
+    {
+#ifdef __linux__
+        for (int& descriptor : m_descriptors)
+        {
+            if (descriptor >= 0)
+            {
+                ::close(descriptor);
+                descriptor = -1;
+            }
+        }
+#endif
+    }
+
+    std::array<int, Count> m_descriptors;
+};
+
+#endif
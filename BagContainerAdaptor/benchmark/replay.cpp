@@ -0,0 +1,89 @@
+#include "workload.hpp"
+
+#include <BagContainerAdaptor/counted_multiset.hpp>
+#include <BagContainerAdaptor/linked_list.hpp>
+#include <BagContainerAdaptor/small_vector.hpp>
+#include <BagContainerAdaptor/unrolled_linked_list.hpp>
+
+#include <fstream>
+#include <iostream>
+
+// Replays one trace of interleaved inserts, finds and erases by value against every bag backend.
+// The trace is generated from the workload options, or read from --trace=FILE, and can be saved with --save-trace=FILE.
+Harness harness;
+
+template <typename Container>
+void replay(const std::string& name, const Trace& trace)
+{
+    harness.section(name + ", " + std::to_string(trace.size()) + " operations");
+    harness.run("Trace throughput", trace.size(), TraceReplay<Container>::replay, trace);
+
+    if (!harness.selected("Latency"))
+    {
+        return;
+    }
+
+    auto latencies = TraceReplay<Container>::latencies(trace);
+    harness.record("Latency insert", std::move(latencies.insert));
+    harness.record("Latency find", std::move(latencies.find));
+    harness.record("Latency erase value", std::move(latencies.eraseValue));
+}
+
+int main(int argc, char** argv)
+{
+    WorkloadOptions workload;
+    std::string tracePath;
+    std::string savePath;
+
+    harness.configure(
+        argc, argv,
+        [&](const std::string& argument) {
+            return workload.parse(argument) || Harness::option(argument, "--trace=", tracePath) ||
+                   Harness::option(argument, "--save-trace=", savePath);
+        },
+        std::string(WorkloadOptions::usage()) + " [--trace=FILE] [--save-trace=FILE]");
+
+    Trace trace;
+    try
+    {
+        if (tracePath.empty())
+        {
+            trace = generateTrace(workload);
+        }
+        else
+        {
+            std::ifstream file(tracePath);
+            if (!file)
+            {
+                throw std::runtime_error("Could not open trace " + tracePath);
+            }
+            trace = readTrace(file);
+        }
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    if (!savePath.empty())
+    {
+        std::ofstream file(savePath);
+        writeTrace(file, trace);
+    }
+
+    replay<std::vector<int>>("std::vector", trace);
+    replay<std::deque<int>>("std::deque", trace);
+    replay<std::list<int>>("std::list", trace);
+    replay<LinkedList<int>>("LinkedList", trace);
+    replay<std::forward_list<int>>("std::forward_list", trace);
+    replay<std::multiset<int>>("std::multiset", trace);
+    replay<std::unordered_multiset<int>>("std::unordered_multiset", trace);
+    replay<IndexedVector<int>>("IndexedVector", trace);
+    replay<SmallVector<int, 16>>("SmallVector, 16 inline elements", trace);
+    replay<UnrolledLinkedList<int>>("UnrolledLinkedList", trace);
+    replay<CountedMultiset<int>>("CountedMultiset", trace);
+
+    harness.finish();
+    return 0;
+}
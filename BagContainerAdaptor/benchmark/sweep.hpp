@@ -0,0 +1,374 @@
+#ifndef SWEEP_HPP
+#define SWEEP_HPP
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+// The sizes of the sweep mode of the benchmark, `--sweep` turns it on.
+struct SweepOptions
+{
+    bool enabled = false;
+    std::size_t minSize = 100;
+    std::size_t maxSize = 1000000;
+    std::size_t stepsPerDecade = 2;
+
+    bool parse(const std::string& argument)
+    {
+        if (argument == "--sweep")
+        {
+            enabled = true;
+            return true;
+        }
+
+        return Harness::option(argument, "--min-size=", minSize) || Harness::option(argument, "--max-size=", maxSize) ||
+               Harness::option(argument, "--steps-per-decade=", stepsPerDecade);
+    }
+
+    static const char* usage()
+    {
+        return "[--sweep] [--min-size=N] [--max-size=N] [--steps-per-decade=N]";
+    }
+
+    // Geometric sizes from minSize to maxSize, both included.
+    std::vector<std::size_t> sizes() const
+    {
+        const std::size_t first = std::max<std::size_t>(minSize, 1);
+        const std::size_t last = std::min<std::size_t>(std::max(maxSize, first), static_cast<std::size_t>(std::numeric_limits<int>::max()));
+        const double step = std::pow(10.0, 1.0 / static_cast<double>(std::max<std::size_t>(stepsPerDecade, 1)));
+
+        std::vector<std::size_t> sizes;
+        for (double size = static_cast<double>(first); size < static_cast<double>(last) * (1.0 + 1e-9); size *= step)
+        {
+            const auto rounded = static_cast<std::size_t>(std::llround(size));
+            if (sizes.empty() || rounded != sizes.back())
+            {
+                sizes.push_back(rounded);
+            }
+        }
+        if (sizes.back() != last)
+        {
+            sizes.push_back(last);
+        }
+        return sizes;
+    }
+};
+
+enum class Complexity
+{
+    Constant,
+    Logarithmic,
+    Linear
+};
+
+inline const char* complexityName(Complexity complexity)
+{
+    switch (complexity)
+    {
+        case Complexity::Constant:
+            return "O(1)";
+        case Complexity::Logarithmic:
+            return "O(log n)";
+        case Complexity::Linear:
+            return "O(n)";
+    }
+    return "";
+}
+
+// Nanoseconds per operation modelled as coefficient * f(n), where f is the function of the complexity.
+struct ComplexityFit
+{
+    Complexity complexity = Complexity::Constant;
+    double coefficient = 0.0;
+
+    // Root mean square of the residuals relative to the measured times, smaller is a better fit.
+    double rms = 0.0;
+};
+
+// Least squares fit of every model, the model with the smallest residuals wins.
+// The residuals are relative to the measured times, so every size of the geometric sweep weighs the same
+// instead of the largest sizes deciding the fit alone.
+inline ComplexityFit fitComplexity(const std::vector<std::size_t>& sizes, const std::vector<double>& nanoseconds)
+{
+    ComplexityFit best;
+    best.rms = std::numeric_limits<double>::infinity();
+
+    for (Complexity complexity : {Complexity::Constant, Complexity::Logarithmic, Complexity::Linear})
+    {
+        const auto f = [complexity](std::size_t n) {
+            const double size = static_cast<double>(n);
+            return complexity == Complexity::Constant ? 1.0 : complexity == Complexity::Logarithmic ? std::log2(std::max(size, 2.0)) : size;
+        };
+
+        // Minimizes the sum of ((t - c * f(n)) / t)^2, times of zero would divide by zero and are left out.
+        double sum = 0.0;
+        double squares = 0.0;
+        for (std::size_t i = 0; i < sizes.size(); i++)
+        {
+            if (nanoseconds[i] > 0.0)
+            {
+                sum += f(sizes[i]) / nanoseconds[i];
+                squares += f(sizes[i]) * f(sizes[i]) / (nanoseconds[i] * nanoseconds[i]);
+            }
+        }
+        const double coefficient = squares > 0.0 ? sum / squares : 0.0;
+
+        double residuals = 0.0;
+        for (std::size_t i = 0; i < sizes.size(); i++)
+        {
+            if (nanoseconds[i] > 0.0)
+            {
+                const double residual = 1.0 - coefficient * f(sizes[i]) / nanoseconds[i];
+                residuals += residual * residual;
+            }
+        }
+        const double rms = std::sqrt(residuals / static_cast<double>(sizes.size()));
+
+        // Prefer the slower growing model on ties, a flat series fits every model equally.
+        if (rms < best.rms * 0.999)
+        {
+            best.complexity = complexity;
+            best.coefficient = coefficient;
+            best.rms = rms;
+        }
+    }
+
+    return best;
+}
+
+// Nanoseconds per operation of one backend at every size of the sweep.
+struct SweepSeries
+{
+    std::string backend;
+    std::vector<double> nanoseconds;
+};
+
+// A size range where the faster of two backends changes.
+// `first` is faster at `below` and `second` is faster at `above`, the next measured size.
+struct Crossover
+{
+    std::string first;
+    std::string second;
+    std::size_t below;
+    std::size_t above;
+};
+
+// A backend counts as faster when it takes at most 90% of the time of the other, closer times are ties and
+// do not end a range, so noise around equal times does not report crossovers.
+inline std::vector<Crossover> findCrossovers(const std::vector<std::size_t>& sizes, const std::vector<SweepSeries>& series)
+{
+    std::vector<Crossover> crossovers;
+
+    for (std::size_t a = 0; a < series.size(); a++)
+    {
+        for (std::size_t b = a + 1; b < series.size(); b++)
+        {
+            int previous = 0;
+            std::size_t previousSize = 0;
+
+            for (std::size_t i = 0; i < sizes.size(); i++)
+            {
+                const double ratio = series[a].nanoseconds[i] / series[b].nanoseconds[i];
+                const int faster = ratio < 0.9 ? 1 : ratio > 1.0 / 0.9 ? -1 : 0;
+                if (faster == 0)
+                {
+                    continue;
+                }
+
+                if (previous != 0 && faster != previous)
+                {
+                    const std::string& first = previous == 1 ? series[a].backend : series[b].backend;
+                    const std::string& second = previous == 1 ? series[b].backend : series[a].backend;
+                    crossovers.push_back(Crossover{first, second, previousSize, sizes[i]});
+                }
+                previous = faster;
+                previousSize = sizes[i];
+            }
+        }
+    }
+
+    return crossovers;
+}
+
+// Median nanoseconds of one call of `operation`, timed in batches long enough for the clock.
+// The batch doubles until it takes 200 microseconds, then every repetition times one batch.
+template <typename Callback>
+double measurePerOperation(Callback operation, std::size_t repetitions)
+{
+    using Clock = std::chrono::steady_clock;
+    const auto timeBatch = [&operation](std::size_t batch) {
+        clobberMemory();
+        const auto begin = Clock::now();
+        for (std::size_t i = 0; i < batch; i++)
+        {
+            operation(i);
+        }
+        const auto end = Clock::now();
+        clobberMemory();
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+    };
+
+    std::size_t batch = 1;
+    while (batch < (std::size_t(1) << 24) && timeBatch(batch) < 200000.0)
+    {
+        batch *= 2;
+    }
+
+    std::vector<double> samples;
+    for (std::size_t i = 0; i < repetitions; i++)
+    {
+        samples.push_back(timeBatch(batch) / static_cast<double>(batch));
+    }
+    return summarize(std::move(samples)).median;
+}
+
+// The operations of the sweep on a bag of the container, filled with the distinct ints [0, n) in random order.
+template <typename Container>
+class SweepBenchmark
+{
+public:
+    // Nanoseconds per operation of find, back, size and an insert followed by the erase of the same value.
+    static std::vector<double> measure(std::size_t n, std::size_t repetitions)
+    {
+        std::mt19937 generator(static_cast<std::mt19937::result_type>(n));
+
+        std::vector<int> values(n);
+        std::iota(values.begin(), values.end(), 0);
+        std::shuffle(values.begin(), values.end(), generator);
+
+        BagContainerAdaptor<int, Container> adapter;
+        adapter.reserve(n);
+        adapter.insert(values.begin(), values.end());
+
+        // The same keys for every backend of this size, each present in the bag.
+        std::vector<int> keys(1024);
+        std::uniform_int_distribution<int> distribution(0, static_cast<int>(n) - 1);
+        for (int& key : keys)
+        {
+            key = distribution(generator);
+        }
+
+        const int absent = static_cast<int>(n);
+
+        return {measurePerOperation([&](std::size_t i) { doNotOptimize(adapter.find(keys[i % keys.size()])); }, repetitions),
+                measurePerOperation([&](std::size_t) { doNotOptimize(adapter.back()); }, repetitions),
+                measurePerOperation([&](std::size_t) { doNotOptimize(adapter.size()); }, repetitions),
+                measurePerOperation(
+                    [&](std::size_t) {
+                        adapter.insert(absent);
+                        doNotOptimize(adapter.erase(absent));
+                    },
+                    repetitions)};
+    }
+};
+
+// Runs every operation of every added backend over the sizes, then prints the timings, fitted complexities and crossovers.
+class Sweep
+{
+public:
+    Sweep(Harness& harness, const SweepOptions& options) : m_harness(harness), m_sizes(options.sizes()), m_series(operationNames().size())
+    {
+    }
+
+    static const std::vector<std::string>& operationNames()
+    {
+        static const std::vector<std::string> names{"find", "back", "size", "insert and erase value"};
+        return names;
+    }
+
+    template <typename Container>
+    void add(const std::string& backend)
+    {
+        m_harness.section("Sweep");
+        if (!m_harness.selected(backend))
+        {
+            return;
+        }
+
+        std::cout << "Sweeping " << backend << std::endl;
+
+        for (std::vector<SweepSeries>& series : m_series)
+        {
+            series.push_back(SweepSeries{backend, {}});
+        }
+
+        for (std::size_t size : m_sizes)
+        {
+            const std::vector<double> nanoseconds = SweepBenchmark<Container>::measure(size, m_harness.repetitions());
+
+            for (std::size_t operation = 0; operation < nanoseconds.size(); operation++)
+            {
+                m_series[operation].back().nanoseconds.push_back(nanoseconds[operation]);
+
+                Result result;
+                result.section = "Sweep " + operationNames()[operation];
+                result.name = backend;
+                result.operations = 1;
+                result.repetitions = m_harness.repetitions();
+                result.elements = size;
+                result.nanosecondsPerOperation.median = nanoseconds[operation];
+                m_harness.add(result);
+            }
+        }
+    }
+
+    void report() const
+    {
+        const auto precision = std::cout.precision();
+        std::cout << std::fixed << std::setprecision(2);
+
+        for (std::size_t operation = 0; operation < m_series.size(); operation++)
+        {
+            const std::vector<SweepSeries>& series = m_series[operation];
+            if (series.empty())
+            {
+                continue;
+            }
+
+            std::cout << std::endl << "Sweep " << operationNames()[operation] << ", median ns/op" << std::endl;
+            for (const SweepSeries& backend : series)
+            {
+                std::cout << backend.backend << ":";
+                for (std::size_t i = 0; i < m_sizes.size(); i++)
+                {
+                    std::cout << " n=" << m_sizes[i] << " " << backend.nanoseconds[i];
+                }
+
+                const ComplexityFit fit = fitComplexity(m_sizes, backend.nanoseconds);
+                std::cout << ". Fits " << complexityName(fit.complexity) << " with coefficient " << std::setprecision(3)
+                          << std::defaultfloat << fit.coefficient << std::fixed << std::setprecision(2) << ", relative rms " << fit.rms
+                          << "." << std::endl;
+            }
+
+            for (const Crossover& crossover : findCrossovers(m_sizes, series))
+            {
+                std::cout << "Crossover: " << crossover.first << " is faster than " << crossover.second << " up to n=" << crossover.below
+                          << ", slower from n=" << crossover.above << "." << std::endl;
+            }
+        }
+
+        std::cout.unsetf(std::ios::floatfield);
+        std::cout.precision(precision);
+    }
+
+private:
+    Harness& m_harness;
+    std::vector<std::size_t> m_sizes;
+
+    // One list of series per operation, in the order of operationNames.
+    std::vector<std::vector<SweepSeries>> m_series;
+};
+
+#endif
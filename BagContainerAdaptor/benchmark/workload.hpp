@@ -0,0 +1,259 @@
+#ifndef WORKLOAD_HPP
+#define WORKLOAD_HPP
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+
+#include "harness.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// The operations a trace interleaves, the values are the letters of the trace file format.
+enum class Operation : char
+{
+    Insert = 'i',
+    Find = 'f',
+    EraseValue = 'e'
+};
+
+struct TraceEntry
+{
+    Operation operation;
+    int key;
+};
+
+using Trace = std::vector<TraceEntry>;
+
+// What generateTrace produces, parsed from the options of the replay benchmark.
+struct WorkloadOptions
+{
+    std::size_t operations = 50000;
+
+    // Relative weights of the operations, they do not need to sum to 100.
+    double insertShare = 70.0;
+    double findShare = 20.0;
+    double eraseShare = 10.0;
+
+    // Keys are drawn from [0, keys) with probability proportional to 1 / rank^zipf, 0 is uniform.
+    std::size_t keys = 10000;
+    double zipf = 0.99;
+
+    std::uint64_t seed = 42;
+
+    bool parse(const std::string& argument)
+    {
+        std::size_t seedValue = 0;
+        if (Harness::option(argument, "--seed=", seedValue))
+        {
+            seed = seedValue;
+            return true;
+        }
+
+        return Harness::option(argument, "--operations=", operations) || Harness::option(argument, "--keys=", keys) ||
+               Harness::option(argument, "--zipf=", zipf) || Harness::option(argument, "--insert=", insertShare) ||
+               Harness::option(argument, "--find=", findShare) || Harness::option(argument, "--erase=", eraseShare);
+    }
+
+    static const char* usage()
+    {
+        return "[--operations=N] [--insert=W] [--find=W] [--erase=W] [--keys=N] [--zipf=S] [--seed=N]";
+    }
+};
+
+// Zipf distributed ranks in [0, n), sampled by a binary search of the cumulative distribution.
+class ZipfDistribution
+{
+public:
+    ZipfDistribution(std::size_t n, double exponent) : m_cumulative(std::max<std::size_t>(n, 1))
+    {
+        double total = 0.0;
+        for (std::size_t rank = 0; rank < m_cumulative.size(); rank++)
+        {
+            total += 1.0 / std::pow(static_cast<double>(rank + 1), exponent);
+            m_cumulative[rank] = total;
+        }
+        for (double& probability : m_cumulative)
+        {
+            probability /= total;
+        }
+    }
+
+    template <typename Generator>
+    std::size_t operator()(Generator& generator) const
+    {
+        const double u = std::uniform_real_distribution<double>(0.0, 1.0)(generator);
+        const auto it = std::lower_bound(m_cumulative.begin(), m_cumulative.end(), u);
+        return std::min(static_cast<std::size_t>(it - m_cumulative.begin()), m_cumulative.size() - 1);
+    }
+
+private:
+    std::vector<double> m_cumulative;
+};
+
+// The same options and seed give the same trace with the same standard library.
+// Use writeTrace and readTrace to replay exactly the same operations elsewhere.
+inline Trace generateTrace(const WorkloadOptions& options)
+{
+    if (options.keys == 0 || options.keys > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+    {
+        throw std::invalid_argument("The amount of keys must be in [1, INT_MAX]");
+    }
+    if (options.insertShare < 0.0 || options.findShare < 0.0 || options.eraseShare < 0.0 ||
+        options.insertShare + options.findShare + options.eraseShare <= 0.0)
+    {
+        throw std::invalid_argument("The operation weights must be non-negative and not all zero");
+    }
+
+    std::mt19937_64 generator(options.seed);
+    std::discrete_distribution<int> operations{options.insertShare, options.findShare, options.eraseShare};
+    ZipfDistribution ranks(options.keys, options.zipf);
+
+    // The most popular keys are spread over the key space, so they are not all next to each other in ordered bags.
+    std::vector<int> keys(options.keys);
+    std::iota(keys.begin(), keys.end(), 0);
+    std::shuffle(keys.begin(), keys.end(), generator);
+
+    const Operation kinds[] = {Operation::Insert, Operation::Find, Operation::EraseValue};
+
+    Trace trace;
+    trace.reserve(options.operations);
+    for (std::size_t i = 0; i < options.operations; i++)
+    {
+        const Operation operation = kinds[operations(generator)];
+        trace.push_back(TraceEntry{operation, keys[ranks(generator)]});
+    }
+    return trace;
+}
+
+// The trace file format is a header line followed by one operation per line, a letter and a key: "i 42", "f 7" or "e 3".
+// Empty lines and lines starting with '#' are skipped.
+inline void writeTrace(std::ostream& out, const Trace& trace)
+{
+    out << "# bag trace 1\n";
+    for (const TraceEntry& entry : trace)
+    {
+        out << static_cast<char>(entry.operation) << ' ' << entry.key << '\n';
+    }
+}
+
+// Throws std::runtime_error with the line number when a line is not an operation.
+inline Trace readTrace(std::istream& in)
+{
+    Trace trace;
+    std::string line;
+    for (std::size_t number = 1; std::getline(in, line); number++)
+    {
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        char letter = 0;
+        int key = 0;
+        std::string rest;
+        if (!(fields >> letter >> key) || (fields >> rest) ||
+            (letter != static_cast<char>(Operation::Insert) && letter != static_cast<char>(Operation::Find) &&
+             letter != static_cast<char>(Operation::EraseValue)))
+        {
+            throw std::runtime_error("Malformed trace line " + std::to_string(number) + ": " + line);
+        }
+
+        trace.push_back(TraceEntry{static_cast<Operation>(letter), key});
+    }
+    return trace;
+}
+
+// Replays a trace on an empty bag of the container.
+template <typename Container>
+class TraceReplay
+{
+public:
+    // Throughput run, returns the finds that hit and the erased elements so the work is not optimized away.
+    static std::size_t replay(const Trace& trace)
+    {
+        BagContainerAdaptor<int, Container> adapter;
+        std::size_t checksum = 0;
+
+        for (const TraceEntry& entry : trace)
+        {
+            checksum += apply(adapter, entry);
+        }
+
+        doNotOptimize(checksum);
+        return checksum;
+    }
+
+    // Nanoseconds of each operation of the trace, separately for every kind of operation.
+    // A clock read costs some tens of nanoseconds, which is included in every sample.
+    struct Latencies
+    {
+        std::vector<double> insert;
+        std::vector<double> find;
+        std::vector<double> eraseValue;
+    };
+
+    static Latencies latencies(const Trace& trace)
+    {
+        Latencies latencies;
+        latencies.insert.reserve(trace.size());
+        latencies.find.reserve(trace.size());
+        latencies.eraseValue.reserve(trace.size());
+
+        BagContainerAdaptor<int, Container> adapter;
+        std::size_t checksum = 0;
+
+        for (const TraceEntry& entry : trace)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            checksum += apply(adapter, entry);
+            const auto end = std::chrono::steady_clock::now();
+
+            const auto elapsed = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count());
+            switch (entry.operation)
+            {
+                case Operation::Insert:
+                    latencies.insert.push_back(elapsed);
+                    break;
+                case Operation::Find:
+                    latencies.find.push_back(elapsed);
+                    break;
+                case Operation::EraseValue:
+                    latencies.eraseValue.push_back(elapsed);
+                    break;
+            }
+        }
+
+        doNotOptimize(checksum);
+        return latencies;
+    }
+
+private:
+    static std::size_t apply(BagContainerAdaptor<int, Container>& adapter, const TraceEntry& entry)
+    {
+        switch (entry.operation)
+        {
+            case Operation::Insert:
+                adapter.insert(entry.key);
+                return 0;
+            case Operation::Find:
+                return adapter.find(entry.key) != adapter.end() ? 1 : 0;
+            case Operation::EraseValue:
+                return adapter.erase(entry.key);
+        }
+        return 0;
+    }
+};
+
+#endif
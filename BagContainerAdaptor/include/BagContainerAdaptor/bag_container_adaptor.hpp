@@ -4,11 +4,119 @@
 #include <algorithm>
 #include <deque>
 #include <forward_list>
+#include <initializer_list>
+#include <iterator>
 #include <list>
 #include <set>
+#include <type_traits>
 #include <unordered_set>
 #include <vector>
 
+#include "container_traits.hpp"
+#include "counted_multiset.hpp"
+#include "indexed_vector.hpp"
+#include "intrusive_list.hpp"
+#include "linked_list.hpp"
+#include "simd_search.hpp"
+#include "slot_map.hpp"
+#include "small_vector.hpp"
+#include "unrolled_linked_list.hpp"
+
+/// Bookkeeping that BagContainerAdaptor keeps alongside its underlying container.
+/// The primary template is empty, so containers that track their own state pay nothing for it
+/// once the empty base optimization applies.
+/// \tparam Container The underlying container type.
+template <typename Container>
+class BagContainerState
+{
+protected:
+    /// Recalculate the bookkeeping for a container that was replaced as a whole.
+    /// \param container The new underlying container.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void resetState(const Container&) noexcept
+    {
+    }
+
+    /// Swap the bookkeeping with the bookkeeping of another bag.
+    /// \param other The bookkeeping of the other bag.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swapState(BagContainerState&) noexcept
+    {
+    }
+};
+
+/// Bookkeeping specialized for std::forward_list, which has neither size() nor back() member functions.
+/// \tparam T The type of the items in the std::forward_list.
+/// \tparam Allocator The allocator type of the std::forward_list.
+template <typename T, typename Allocator>
+class BagContainerState<std::forward_list<T, Allocator>>
+{
+protected:
+    /// Recount the elements and locate the last element of a container that was replaced as a whole.
+    /// \param container The new underlying container.
+    /// \post `m_count` equals the amount of elements in `container` and `m_last` points to its last element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(n) Where n is the amount of elements in the `container`.
+    void resetState(const std::forward_list<T, Allocator>& container) noexcept
+    {
+        m_count = 0;
+        m_last = container.cbefore_begin();
+
+        for (auto it = container.cbegin(); it != container.cend(); ++it)
+        {
+            m_last = it;
+            ++m_count;
+        }
+    }
+
+    /// Swap the bookkeeping with the bookkeeping of another bag.
+    /// \param other The bookkeeping of the other bag.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swapState(BagContainerState& other) noexcept
+    {
+        std::swap(m_count, other.m_count);
+        std::swap(m_last, other.m_last);
+    }
+
+    /// The amount of elements in the std::forward_list, updated by every insert and erase of the adaptor.
+    std::size_t m_count = 0;
+
+    /// Points to the last element in iteration order, only meaningful while the container is not empty.
+    typename std::forward_list<T, Allocator>::const_iterator m_last;
+};
+
+/// Bookkeeping specialized for std::unordered_multiset, whose iteration order changes on every rehash.
+/// \tparam T The type of the items in the std::unordered_multiset.
+/// \tparam Hash The hash function of the std::unordered_multiset.
+/// \tparam KeyEqual The equality comparison of the std::unordered_multiset.
+/// \tparam Allocator The allocator type of the std::unordered_multiset.
+template <typename T, typename Hash, typename KeyEqual, typename Allocator>
+class BagContainerState<std::unordered_multiset<T, Hash, KeyEqual, Allocator>>
+{
+protected:
+    /// Designate the implied last element of a container that was replaced as a whole.
+    /// \param container The new underlying container.
+    /// \post `m_last` points to the first element in iteration order, or is null if the `container` is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void resetState(const std::unordered_multiset<T, Hash, KeyEqual, Allocator>& container) noexcept
+    {
+        m_last = container.empty() ? nullptr : &*container.cbegin();
+    }
+
+    /// Swap the bookkeeping with the bookkeeping of another bag.
+    /// \param other The bookkeeping of the other bag.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swapState(BagContainerState& other) noexcept
+    {
+        std::swap(m_last, other.m_last);
+    }
+
+    /// Points to the element designated as the implied last one. Rehashing invalidates the iterators of
+    /// std::unordered_multiset but not pointers to its elements, so the designation only changes when the element itself is erased.
+    const T* m_last = nullptr;
+};
+
 /// Bag is an abstract data type that can store a collection of elements without regard to their order.
 /// Equal elements can appear multiple times in a bag. Although the elements container in a bag have no inherit order,
 /// iterating over the bag elements is guaranteed to visit each element exactly once.
@@ -17,7 +125,7 @@
 /// \tparam Type the type of the items in the underlying type.
 /// \tparam Container The underlying container type.
 template <typename Type, typename Container = std::vector<Type>>
-class BagContainerAdaptor
+class BagContainerAdaptor : private BagContainerState<Container>
 {
 public:
     /// The value type of the underlying container.
@@ -30,8 +138,9 @@ public:
     using const_iterator = typename Container::const_iterator;
 
     /// Default constructor.
-    /// \exception noexcept No exceptions are thrown by this operation.
-    BagContainerAdaptor() noexcept = default;
+    /// \exception noexcept No exceptions are thrown by this operation, unless the default constructor of the container throws,
+    /// as it does with an allocator that allocates when constructed, such as PoolAllocator.
+    BagContainerAdaptor() noexcept(std::is_nothrow_default_constructible<Container>::value) = default;
 
     /// Move constructor.
     /// \param container The underlying container from which the `BagContainerAdaptor` is constructed.
@@ -41,6 +150,7 @@ public:
     BagContainerAdaptor(Container&& container) noexcept
         : m_container(std::move(container))
     {
+        this->resetState(m_container);
     }
 
     /// Move assignment operator.
@@ -55,6 +165,8 @@ public:
         if (this != &other)
         {
             m_container = std::move(other.m_container);
+            BagContainerState<Container>::operator=(other);
+            other.resetState(other.m_container);
         }
         return *this;
     }
@@ -67,6 +179,7 @@ public:
     BagContainerAdaptor(const BagContainerAdaptor& other) noexcept
         : m_container(other.m_container)
     {
+        this->resetState(m_container);
     }
 
     /// Copy assignment operator.
@@ -79,6 +192,7 @@ public:
         if (this != &other)
         {
             m_container = other.m_container;
+            this->resetState(m_container);
         }
         return *this;
     }
@@ -97,6 +211,71 @@ public:
         return insertImpl(m_container, value);
     }
 
+    /// Insert element to the underlying container by moving it.
+    /// \param value The value to be moved into the underlying container.
+    /// \return An iterator that points to the inserted element.
+    /// \post The `value` is moved to the underlying container, and `value` is left in a valid but unspecified state.
+    /// \note Iterators might be invalidated in certain cases or specific container types,
+    /// 	especially if reallocation occurs due to insufficient capacity.
+    /// \exception Depending on the underlying container's insertion operations, this function might throw exceptions like `std::bad_alloc`
+    ///            if memory allocation fails.
+    iterator insert(value_type&& value)
+    {
+        return insertImpl(m_container, std::move(value));
+    }
+
+    /// Construct element in-place in the underlying container.
+    /// \param args The arguments forwarded to the constructor of the element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return An iterator that points to the constructed element.
+    /// \post A new element constructed from `args` is added to the underlying container without intermediate copies.
+    /// \note Iterators might be invalidated in certain cases or specific container types,
+    /// 	especially if reallocation occurs due to insufficient capacity.
+    /// \exception Depending on the underlying container's emplace operations, this function might throw exceptions like `std::bad_alloc`
+    ///            if memory allocation fails, or any exception thrown by the constructor of the element.
+    template <typename... Args>
+    iterator emplace(Args&&... args)
+    {
+        return insertImpl(m_container, std::forward<Args>(args)...);
+    }
+
+    /// Insert a range of elements to the underlying container.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam InputIt The type of the iterators, must meet the requirements of an input iterator.
+    /// \pre [first, last) must be a valid range that does not refer to the elements of this bag.
+    /// \post All elements of the range are inserted to the underlying container.
+    /// \note When `InputIt` is a forward iterator the underlying container grows at most once,
+    ///       node based containers link the whole range in one operation.
+    /// \exception Depending on the underlying container's insertion operations, this function might throw exceptions like `std::bad_alloc`
+    ///            if memory allocation fails.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert(InputIt first, InputIt last)
+    {
+        insertRangeImpl(m_container, first, last);
+    }
+
+    /// Insert elements from an initializer list to the underlying container.
+    /// \param list The initializer list containing the inserted values.
+    /// \post All elements of `list` are inserted to the underlying container.
+    /// \exception Depending on the underlying container's insertion operations, this function might throw exceptions like `std::bad_alloc`
+    ///            if memory allocation fails.
+    void insert(std::initializer_list<value_type> list)
+    {
+        insertRangeImpl(m_container, list.begin(), list.end());
+    }
+
+    /// Prepare the underlying container to hold at least the specified amount of elements.
+    /// \param count The total amount of elements the bag is expected to hold.
+    /// \post std::vector reserves capacity and std::unordered_multiset allocates buckets for `count` elements,
+    ///       so that reaching `count` elements does not reallocate or rehash. Other containers are left unchanged.
+    /// \exception std::length_error if `count` exceeds the maximum size of the underlying container,
+    ///            std::bad_alloc if memory allocation fails.
+    void reserve(std::size_t count)
+    {
+        reserveImpl(m_container, count);
+    }
+
     /// Removes a specified element from the underlying container.
     /// \param elem An iterator pointing to the element to be removed from the underlying container.
     /// \pre The `elem` iterator must be a valid iterator that points to a position within the underlying container
@@ -106,9 +285,11 @@ public:
     /// \exception Depending on the underlying container's erase operation, this function might throw exceptions like:
     ///            - For std::vector: std::out_of_range if the `elem` iterator is invalid.
     /// \note This function may invalidate all iterators pointing to elements within the container.
+    ///       std::vector, std::deque and std::forward_list bags fill the hole with another element of the bag,
+    ///       so the value behind some other iterator may change.
     /// \par Time complexity:
-    /// - O(1) For containers with constant-time erase operation (e.g., std::vector, std::deque).
-    /// - O(n) For containers with linear-time erase operation (e.g., std::list, std::forward_list) where n is the number of elements.
+    /// - O(1) For std::vector, std::deque, std::list and std::forward_list.
+    /// - Amortized O(1) For std::multiset and std::unordered_multiset.
     void erase(iterator elem)
     {
         return eraseImpl(m_container, elem);
@@ -116,16 +297,34 @@ public:
 
     /// Erase all elements that have the specified value in the underlying container.
     /// \param value The value of the elements that are removed.
+    /// \return The amount of removed elements.
     /// \post All elements equal to the specified value in the underlying container are removed, and the BagContainerAdaptor object
     ///       is modified accordingly.
     /// \note This function may invalidate all iterators pointing to elements within the container.
     /// \exception Any exception that may be thrown by the underlying container's `erase` function.
     ///         This typically includes exceptions like those related to invalid iterators or invalid operations on the container.
-    void erase(const value_type& value)
+    std::size_t erase(const value_type& value)
     {
         return eraseImpl(m_container, value);
     }
 
+    /// Erase all elements that satisfy the specified predicate in the underlying container.
+    /// \param pred The unary predicate that returns true for the elements that are removed.
+    /// \tparam Predicate The type of the predicate, callable with `const value_type&`.
+    /// \return The amount of removed elements.
+    /// \post All elements for which `pred` returns true are removed from the underlying container.
+    /// \note This function may invalidate all iterators pointing to elements within the container.
+    ///       std::vector and std::deque bags move surviving elements from the back into the holes,
+    ///       so the order of the survivors is not preserved.
+    /// \exception Any exception thrown by `pred` or by the move assignment of the elements.
+    /// \par Time complexity:
+    /// - O(n) For all supported containers, `pred` is called exactly once for every element.
+    template <typename Predicate>
+    std::size_t erase_if(Predicate pred)
+    {
+        return eraseIfImpl(m_container, pred);
+    }
+
     /// Swap the contents of two BagContainerAdaptors.
     /// \param other The other bag to be swapped with.
     /// \post The contents of this BagContainerAdaptor are swapped with the contents of the `other` BagContainerAdaptor.
@@ -136,6 +335,26 @@ public:
     void swap(BagContainerAdaptor& other) noexcept
     {
         m_container.swap(other.m_container);
+        this->swapState(other);
+    }
+
+    /// Move all elements of another bag into this bag.
+    /// \param other The bag whose elements are moved, left empty.
+    /// \post This bag holds its own elements and the elements of `other`, `other` is empty.
+    /// \exception Any exception thrown by the range insert when the elements are moved one by one,
+    ///            `other` is then left valid but with unspecified contents.
+    /// \note List based bags whose allocators compare equal relink the nodes of `other` without copying,
+    ///       moving or allocating any element, and iterators to the moved elements stay valid.
+    ///       Other bags move the elements through their range insert.
+    /// \par Time complexity:
+    /// - O(1) For std::list, std::forward_list and LinkedList with equal allocators.
+    /// - O(m) Where m is the amount of elements in `other`, for other containers.
+    void merge(BagContainerAdaptor&& other)
+    {
+        if (this != &other)
+        {
+            mergeImpl(m_container, other);
+        }
     }
 
     /// Get iterator pointing to the first element in the underlying container.
@@ -192,6 +411,33 @@ public:
         return findImpl(m_container, value);
     }
 
+    /// Get the amount of elements with the specified value in the underlying container.
+    /// \param value The value to compare elements to.
+    /// \return The amount of elements equal to `value`.
+    /// \exception Any exception thrown by the comparison or hash function of the elements.
+    /// \par Time complexity:
+    /// - O(log n + k) For std::multiset, where k is the amount of matching elements.
+    /// - Average O(k) For std::unordered_multiset.
+    /// - O(n) For the sequence containers, scanned with std::count.
+    std::size_t count(const value_type& value) const
+    {
+        return countImpl(m_container, value);
+    }
+
+    /// Get the amount of elements that satisfy the specified predicate in the underlying container.
+    /// \param pred The unary predicate that returns true for the counted elements.
+    /// \tparam Predicate The type of the predicate, callable with `const value_type&`.
+    /// \return The amount of elements for which `pred` returns true.
+    /// \exception Any exception thrown by `pred`.
+    /// \par Time complexity:
+    /// - O(d) For CountedMultiset, where d is the amount of distinct values, `pred` is called once per distinct value.
+    /// - O(n) For the other containers, `pred` is called exactly once for every element.
+    template <typename Predicate>
+    std::size_t count_if(Predicate pred) const
+    {
+        return countIfImpl(m_container, pred);
+    }
+
     /// Get reference to the implied first element in the underlying container in const context.
     /// \return Reference to the implied first element in the underlying container.
     /// \pre The container must not be empty.
@@ -205,9 +451,11 @@ public:
     /// \return Reference to the implied last element in the underlying container.
     /// \pre The container must not be empty.
     /// \exception noexcept No exceptions are thrown by this operation.
+    /// \note std::forward_list bags return the last element in iteration order, which the adaptor keeps track of.
+    ///       std::unordered_multiset reorders its elements on rehash, so its bags return a designated element
+    ///       that stays the same until it is erased, after which the first element in iteration order takes its place.
     /// \par Time complexity:
-    /// - 0(1) For containers that support the .back() member function, and std::multiset.
-    /// - 0(n) For std::forward_list and std::unordered_multiset.
+    /// - O(1) For all supported containers.
     const value_type& back() const noexcept
     {
         return backImpl(m_container);
@@ -217,11 +465,8 @@ public:
     /// \return The amount of elements in the underlying container.
     /// \exception noexcept No exceptions are thrown by this operation.
     /// \par Time complexity:
-    /// - O(1) For containers with constant-time size retrieval, such as std::unordered_multiset and std::queue.
-    /// These containers maintain an internal count of elements, allowing direct and constant-time access to the size.
-    /// - O(n) For containers with linear-time size retrieval, such as std::vector, std::deque, std::list and std::multiset.
-    /// These containers do not maintain an internal count of elements, requiring iteration through the elements
-    /// to determine the size, resulting in linear time complexity.
+    /// - O(1) For all supported containers. std::forward_list has no size() member function,
+    /// so the adaptor keeps its own element count that is updated by every insert and erase.
     std::size_t size() const noexcept
     {
         return sizeImpl(m_container);
@@ -238,52 +483,300 @@ public:
 private:
     /// \defgroup insertImplementations Insert functionality for various underlying container types.
 
-    /// Insert element to the underlying container type.
+    /// Construct element in the underlying container type with the strategy chosen by ContainerStrategy.
     /// \param container The underlying container type where the element is inserted.
-    /// \param value The value of the inserted element.
+    /// \param args The arguments forwarded to the constructor of the inserted element.
     /// \tparam C The underlying container type used for BagContainerAdaptor.
+    /// \tparam Args The types of the constructor arguments.
     /// \return An iterator that points to the inserted element.
     /// \pre The `container` must be a valid instance of the underlying container type.
-    /// \post The element `value` is inserted at the last position of the `container`.
+    /// \post The element constructed from `args` is inserted to the `container`.
     /// \exception std::bad_alloc if memory allocation fails during elements insertion.
     /// \note Iterators might be invalidated in certain cases or specific container types,
     /// 	especially if reallocation occurs due to insufficient capacity.
     /// \ingroup insertImplementations
-    template <typename C>
-    iterator insertImpl(C& container, const value_type& value)
+    template <typename C, typename... Args>
+    iterator insertImpl(C& container, Args&&... args)
+    {
+        return insertWith(container, typename ContainerStrategy<C>::Insert(), std::forward<Args>(args)...);
+    }
+
+    /// Construct element with a hint to the end of a sorted or hashed container.
+    /// \note The end of the container is used as the hint, making inserts of non-decreasing values amortized constant time.
+    /// \ingroup insertImplementations
+    template <typename C, typename... Args>
+    iterator insertWith(C& container, std::integral_constant<InsertStrategy, InsertStrategy::EmplaceHint>, Args&&... args)
+    {
+        return container.emplace_hint(container.end(), std::forward<Args>(args)...);
+    }
+
+    /// Construct element at the end of a sequence container.
+    /// \ingroup insertImplementations
+    template <typename C, typename... Args>
+    iterator insertWith(C& container, std::integral_constant<InsertStrategy, InsertStrategy::EmplaceBack>, Args&&... args)
+    {
+        container.emplace_back(std::forward<Args>(args)...);
+        return std::prev(container.end());
+    }
+
+    /// Construct element in a container that chooses the position by itself.
+    /// \ingroup insertImplementations
+    template <typename C, typename... Args>
+    iterator insertWith(C& container, std::integral_constant<InsertStrategy, InsertStrategy::Emplace>, Args&&... args)
     {
-        return container.insert(container.end(), value);
+        return container.emplace(std::forward<Args>(args)...);
     }
 
-    /// Insert element to the underlying container type specialized for std::forward_list.
+    /// Construct element in the underlying container type specialized for std::forward_list.
     /// \param container The underlying container type where the element is inserted.
-    /// \param value The value of the inserted element.
+    /// \param args The arguments forwarded to the constructor of the inserted element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \tparam A The allocator type of the std::forward_list.
     /// \return An iterator that points to the inserted element.
     /// \pre The `container` must be a valid instance of std::forward_list.
-    /// \post The element `value` is inserted at the last position of the `container`.
+    /// \post The element constructed from `args` is inserted at the first position of the `container`.
     /// \exception std::bad_alloc if memory allocation fails during elements insertion.
     /// \note Inserting elements to the beginning of std::forward_list invalidates iterators.
     /// \ingroup insertImplementations
-    iterator insertImpl(std::forward_list<value_type>& container, const value_type& value)
+    template <typename A, typename... Args>
+    iterator insertImpl(std::forward_list<value_type, A>& container, Args&&... args)
+    {
+        auto it = container.emplace_after(container.before_begin(), std::forward<Args>(args)...);
+
+        // The first element of an empty list stays the last one, as later elements are inserted before it.
+        if (this->m_count++ == 0)
+        {
+            this->m_last = it;
+        }
+        return it;
+    }
+
+    /// Construct element in the underlying container type specialized for std::unordered_multiset.
+    /// \param container The underlying container type where the element is inserted.
+    /// \param args The arguments forwarded to the constructor of the inserted element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \tparam H, E, A The hash function, key equality and allocator types of the std::unordered_multiset.
+    /// \return An iterator that points to the inserted element.
+    /// \pre The `container` must be a valid instance of std::unordered_multiset.
+    /// \post The element constructed from `args` is inserted to the bucket matching its hash.
+    /// \exception std::bad_alloc if memory allocation fails during elements insertion.
+    /// \note Iterators are invalidated if the insertion causes a rehash.
+    /// \ingroup insertImplementations
+    template <typename H, typename E, typename A, typename... Args>
+    iterator insertImpl(std::unordered_multiset<value_type, H, E, A>& container, Args&&... args)
+    {
+        auto it = container.emplace(std::forward<Args>(args)...);
+
+        if (container.size() == 1)
+        {
+            this->m_last = &*it;
+        }
+        return it;
+    }
+
+    /// Insert a range of elements to the underlying container type with the strategy chosen by ContainerStrategy.
+    /// \param container The underlying container type where the elements are inserted.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam C The underlying container type used for BagContainerAdaptor.
+    /// \tparam InputIt The type of the iterators of the range.
+    /// \pre The `container` must be a valid instance of the underlying container type.
+    /// \post The elements of the range are inserted to the `container`.
+    /// \exception std::bad_alloc if memory allocation fails during elements insertion.
+    /// \ingroup insertImplementations
+    template <typename C, typename InputIt>
+    void insertRangeImpl(C& container, InputIt first, InputIt last)
+    {
+        insertRangeWith(container, first, last, typename ContainerStrategy<C>::RangeInsert());
+    }
+
+    /// Insert a range at the end of a sequence container.
+    /// \note For forward iterators std::vector and std::deque compute the length of the range up front and grow once,
+    ///       std::list builds the nodes separately and splices them in one go.
+    /// \ingroup insertImplementations
+    template <typename C, typename InputIt>
+    void insertRangeWith(C& container, InputIt first, InputIt last, std::integral_constant<RangeInsertStrategy, RangeInsertStrategy::Positional>)
+    {
+        container.insert(container.end(), first, last);
+    }
+
+    /// Insert a range to a container that chooses the positions by itself.
+    /// \note For forward iterators the container is reserved once for the final size before inserting.
+    /// \ingroup insertImplementations
+    template <typename C, typename InputIt>
+    void insertRangeWith(C& container, InputIt first, InputIt last, std::integral_constant<RangeInsertStrategy, RangeInsertStrategy::Member>)
+    {
+        reserveForRange(container, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+        container.insert(first, last);
+    }
+
+    /// Insert a range one element at a time to a container without a range insert.
+    /// \note For forward iterators the container is reserved once for the final size before inserting.
+    /// \ingroup insertImplementations
+    template <typename C, typename InputIt>
+    void insertRangeWith(C& container, InputIt first, InputIt last, std::integral_constant<RangeInsertStrategy, RangeInsertStrategy::Loop>)
+    {
+        reserveForRange(container, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+        for (; first != last; ++first)
+        {
+            insertImpl(container, *first);
+        }
+    }
+
+    /// Insert a range of elements to the underlying container type specialized for std::forward_list.
+    /// \param container The underlying container type where the elements are inserted.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam InputIt The type of the iterators of the range.
+    /// \tparam A The allocator type of the std::forward_list.
+    /// \pre The `container` must be a valid instance of std::forward_list.
+    /// \post The elements of the range are inserted at the first position of the `container`.
+    /// \exception std::bad_alloc if memory allocation fails during elements insertion.
+    /// \ingroup insertImplementations
+    template <typename A, typename InputIt>
+    void insertRangeImpl(std::forward_list<value_type, A>& container, InputIt first, InputIt last)
+    {
+        auto lastInserted = container.insert_after(container.before_begin(), first, last);
+        const auto inserted = static_cast<std::size_t>(std::distance(container.begin(), std::next(lastInserted)));
+
+        if (this->m_count == 0 && inserted != 0)
+        {
+            this->m_last = lastInserted;
+        }
+        this->m_count += inserted;
+    }
+
+    /// Insert a range of elements to the underlying container type specialized for std::unordered_multiset.
+    /// \param container The underlying container type where the elements are inserted.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam InputIt The type of the iterators of the range.
+    /// \tparam H, E, A The hash function, key equality and allocator types of the std::unordered_multiset.
+    /// \pre The `container` must be a valid instance of std::unordered_multiset.
+    /// \post The elements of the range are inserted to the buckets matching their hashes.
+    /// \exception std::bad_alloc if memory allocation fails during elements insertion.
+    /// \note For forward iterators the buckets are allocated once for the final size before inserting.
+    /// \ingroup insertImplementations
+    template <typename H, typename E, typename A, typename InputIt>
+    void insertRangeImpl(std::unordered_multiset<value_type, H, E, A>& container, InputIt first, InputIt last)
+    {
+        const bool wasEmpty = container.empty();
+
+        reserveForRange(container, first, last, typename std::iterator_traits<InputIt>::iterator_category());
+        container.insert(first, last);
+
+        if (wasEmpty)
+        {
+            this->resetState(container);
+        }
+    }
+
+    /// Insert a range of elements to the underlying container type specialized for CountedMultiset.
+    /// \param container The underlying container type where the elements are inserted.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam InputIt The type of the iterators of the range.
+    /// \tparam H, E The hash function and key equality types of the CountedMultiset.
+    /// \pre The `container` must be a valid instance of CountedMultiset.
+    /// \post The count of every value in the range is incremented once per occurrence.
+    /// \exception std::bad_alloc if memory allocation fails when a new distinct value is inserted.
+    /// \note Unlike other containers with a range insert, nothing is reserved for the length of the range,
+    ///       since a range of duplicates would allocate buckets for values that are never stored.
+    /// \ingroup insertImplementations
+    template <typename H, typename E, typename InputIt>
+    void insertRangeImpl(CountedMultiset<value_type, H, E>& container, InputIt first, InputIt last)
+    {
+        container.insert(first, last);
+    }
+
+    /// Reserve space for a range whose length can be computed without consuming it.
+    /// \param container The underlying container type that is reserved.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam C The underlying container type used for BagContainerAdaptor.
+    /// \tparam ForwardIt The type of the iterators of the range.
+    /// \post The `container` can hold its current elements and the elements of the range without growing.
+    /// \exception std::bad_alloc if memory allocation fails.
+    /// \ingroup insertImplementations
+    template <typename C, typename ForwardIt>
+    void reserveForRange(C& container, ForwardIt first, ForwardIt last, std::forward_iterator_tag)
+    {
+        reserveImpl(container, sizeImpl(container) + static_cast<std::size_t>(std::distance(first, last)));
+    }
+
+    /// Single pass ranges cannot be measured in advance, so nothing is reserved.
+    /// \ingroup insertImplementations
+    template <typename C, typename InputIt>
+    void reserveForRange(C&, InputIt, InputIt, std::input_iterator_tag) noexcept
+    {
+    }
+
+    /// \defgroup reserveImplementations Capacity reservation for various underlying container types.
+
+    /// Reserve capacity with the strategy chosen by ContainerStrategy.
+    /// \param container The underlying container type.
+    /// \param count The expected amount of elements.
+    /// \tparam C The underlying container type used for BagContainerAdaptor.
+    /// \post Containers with a reserve member can hold `count` elements without reallocating or rehashing.
+    /// \exception std::length_error if `count` is too large, std::bad_alloc if memory allocation fails.
+    /// \ingroup reserveImplementations
+    template <typename C>
+    void reserveImpl(C& container, std::size_t count)
+    {
+        reserveWith(container, count, typename ContainerStrategy<C>::Reserve());
+    }
+
+    /// Reserve capacity through the reserve member of the container.
+    /// \ingroup reserveImplementations
+    template <typename C>
+    void reserveWith(C& container, std::size_t count, std::integral_constant<ReserveStrategy, ReserveStrategy::Member>)
+    {
+        container.reserve(count);
+    }
+
+    /// Reserve nothing for containers that cannot preallocate storage.
+    /// \note Node based containers and std::deque allocate per element or per block.
+    /// \ingroup reserveImplementations
+    template <typename C>
+    void reserveWith(C&, std::size_t, std::integral_constant<ReserveStrategy, ReserveStrategy::None>) noexcept
     {
-        return container.insert_after(container.before_begin(), value);
     }
 
     /// \defgroup eraseImplementations Erase functionality for various underlying container types.
 
-    /// Erase item from the underlying container at the implied position of the iterator.
+    /// Erase item from the underlying container at the implied position of the iterator with the strategy chosen by ContainerStrategy.
     /// \param container The underlying container type where the element is erased.
     /// \param pos The implied position where the item is removed from the container.
     /// \tparam C The underlying container type used for BagContainerAdaptor.
-    /// \return Assumed next iterator following the deleted element.
     /// \pre The `container` must be a valid instance of the specified container type.
-    /// \pre The `pos` iterator must be a valid iterator within the `container`.
+    /// \pre The `pos` iterator must be a valid dereferenceable iterator within the `container`.
     /// \post The element at the position specified by `pos` is removed from the `container`.
-    /// \exception std::out_of_range If the `pos` iterator is invalid or out of range for the container.
+    /// \exception Any exception that may be thrown by the move assignment of the elements or by the `erase` of the container.
     /// \note This function may invalidate all iterators pointing to elements within the container.
     /// \ingroup eraseImplementations
     template <typename C>
     void eraseImpl(C& container, iterator pos)
+    {
+        eraseWith(container, pos, typename ContainerStrategy<C>::Erase());
+    }
+
+    /// Erase item from a random access sequence by moving the last element into its place.
+    /// \note No elements are shifted, but the value behind an iterator to the last element changes.
+    /// \ingroup eraseImplementations
+    template <typename C>
+    void eraseWith(C& container, iterator pos, std::integral_constant<EraseStrategy, EraseStrategy::SwapAndPop>)
+    {
+        if (pos != container.end() - 1)
+        {
+            *pos = std::move(container.back());
+        }
+        container.pop_back();
+    }
+
+    /// Erase item through the erase member of the container.
+    /// \ingroup eraseImplementations
+    template <typename C>
+    void eraseWith(C& container, iterator pos, std::integral_constant<EraseStrategy, EraseStrategy::Member>)
     {
         container.erase(pos);
     }
@@ -291,250 +784,445 @@ private:
     /// Erase item from the underlying container at the implied position of the iterator specialized for std::forward_list.
     /// \param container The underlying container type where the element is erased.
     /// \param pos The position where the element is erased.
+    /// \tparam A The allocator type of the std::forward_list.
     /// \pre The `container` must be a valid instance of std::forward_list.
-    /// \pre The `pos` iterator must be a valid iterator within the `container`.
-    /// \post The element after the `pos` iterator is removed from the `container`.
-    /// \exception std::out_of_range If the `pos` iterator is invalid or out of range for the container.
-    /// \exception Any exception that may be thrown by the underlying container's `erase_after` function.
-    ///         This typically includes exceptions like those related to invalid iterators or invalid operations on the container.
-    /// \note This function may invalidate all iterators pointing to elements within the container.
+    /// \pre The `pos` iterator must be a valid dereferenceable iterator within the `container`.
+    /// \post The value at `pos` is replaced by the value of the first element, and the first element is removed from the `container`.
+    /// \exception Any exception that may be thrown by the move assignment of the elements.
+    /// \note Since the bag has no order, the predecessor of `pos` is never searched for. Only iterators to the first element
+    ///       are invalidated, while `pos` now refers to the value that was at the front.
     /// \ingroup eraseImplementations
-    void eraseImpl(std::forward_list<value_type>& container, iterator pos)
+    template <typename A>
+    void eraseImpl(std::forward_list<value_type, A>& container, iterator pos)
     {
-        if (pos == container.begin())
-        {
-            container.pop_front();
-            container.begin();
-        }
-        else
+        if (pos != container.begin())
         {
-            auto prev = container.before_begin();
-            for (auto it = container.begin(); it != container.end(); ++it)
-            {
-                if (it == pos)
-                {
-                    container.erase_after(prev);
-                }
-                prev = it;
-            }
+            *pos = std::move(container.front());
         }
+
+        // The last node is only removed when it is also the first one, so m_last remains valid.
+        container.pop_front();
+        --this->m_count;
     }
 
-    /// Erase item from the underlying container at the implied position of the iterator specialized for std::deque.
+    /// Erase item from the underlying container at the position of the iterator specialized for std::unordered_multiset.
     /// \param container The underlying container type where the element is erased.
     /// \param pos The position where the element is erased.
-    /// \pre The `container` must be a valid instance of std::deque.
-    /// \pre The `pos` iterator must be a valid iterator within the `container`.
-    /// \pre The `pos` iterator must not be equal to `container.end()`; erasing at `end()` is undefined behavior.
-    /// \post The element at the position of the `pos` iterator is removed from the `container`.
-    /// \exception Throws std::runtime_error if the operation of element removal encounters an exceptional condition.
-    /// \note This function may invalidate all iterators pointing to elements within the container.
+    /// \tparam H, E, A The hash function, key equality and allocator types of the std::unordered_multiset.
+    /// \pre The `container` must be a valid instance of std::unordered_multiset.
+    /// \pre The `pos` iterator must be a valid dereferenceable iterator within the `container`.
+    /// \post The element at the position of the `pos` iterator is removed from the `container`. If it was the
+    ///       implied last element, the first element in iteration order becomes the implied last element.
+    /// \exception Any exception that may be thrown by the hash function of the container.
+    /// \note Only iterators to the erased element are invalidated.
     /// \ingroup eraseImplementations
-    void eraseImpl(std::deque<value_type>& container, iterator pos)
+    template <typename H, typename E, typename A>
+    void eraseImpl(std::unordered_multiset<value_type, H, E, A>& container, iterator pos)
     {
-        if (pos != container.end() - 1)
+        const bool lastErased = &*pos == this->m_last;
+
+        container.erase(pos);
+
+        if (lastErased)
         {
-            *pos = std::move(container.back());
+            this->resetState(container);
         }
-        container.pop_back();
     }
 
-    /// Erase item from the underlying container at the implied position of the iterator specialized for std::vector.
+    /// Erase item from the underlying container at the position of the iterator specialized for UnrolledLinkedList.
     /// \param container The underlying container type where the element is erased.
     /// \param pos The position where the element is erased.
-    /// \pre The `container` must be a valid instance of std::vector.
-    /// \pre The `pos` iterator must be a valid iterator within the `container`.
-    /// \pre The `pos` iterator must not be equal to `container.end()`; erasing at `end()` is undefined behavior.
-    /// \post The element at the position of the `pos` iterator is removed from the `container`.
-    /// \exception Throws std::runtime_error if the operation of element removal encounters an exceptional condition.
-    /// \note This function may invalidate all iterators pointing to elements within the container.
+    /// \tparam K The node capacity of the UnrolledLinkedList.
+    /// \tparam A The allocator type of the UnrolledLinkedList.
+    /// \pre The `container` must be a valid instance of UnrolledLinkedList.
+    /// \pre The `pos` iterator must be a valid dereferenceable iterator within the `container`.
+    /// \post The value of the last element is moved to `pos` and the last element is removed from the `container`.
+    /// \exception Any exception that may be thrown by the move assignment of the elements.
+    /// \note Since the bag has no order, no elements are shifted inside the node of `pos`.
     /// \ingroup eraseImplementations
-    void eraseImpl(std::vector<value_type>& container, iterator pos)
+    template <std::size_t K, typename A>
+    void eraseImpl(UnrolledLinkedList<value_type, K, A>& container, iterator pos)
     {
-        if (pos != container.end() - 1)
+        if (&*pos != &container.back())
         {
             *pos = std::move(container.back());
         }
         container.pop_back();
     }
 
-    /// Erase items from the underlying container that have a specified value.
+    /// Erase items from the underlying container that have a specified value with the strategy chosen by ContainerStrategy.
     /// \param container The underlying container type where the elements are erased.
     /// \param value The value of the removed elements.
+    /// \return The amount of removed elements.
     /// \tparam C The underlying container type used for BagContainerAdaptor.
     /// \pre The `container` must be a valid instance of the specified container type.
-    /// \pre The `container` must have a member function erase.
     /// \post All elements with the specified value are removed from the `container`.
-    /// \exception Any exception that may be thrown by the underlying container's `erase` function.
-    ///         This typically includes exceptions like those related to invalid iterators or invalid operations on the container.
+    /// \exception Any exception that may be thrown by the comparison, the move assignment of the elements
+    ///            or the underlying container's `erase` function.
     /// \note This function may invalidate all iterators pointing to elements within the container.
     /// \ingroup eraseImplementations
     template <typename C>
-    void eraseImpl(C& container, const value_type& value)
+    std::size_t eraseImpl(C& container, const value_type& value)
     {
-        container.erase(value);
+        return eraseValueWith(container, value, typename ContainerStrategy<C>::EraseValue());
     }
 
-    /// Removes all occurrences of a specified value specialized for std::forward_list.
-    /// \param container The underlying container type where the elements are erased.
-    /// \param value The value of the removed elements.
-    /// \pre The `container` must be a valid instance of std::forward_list.
-    /// \post All elements with the specified `value` are removed from the `container`.
-    /// \exception Any exception that may be thrown by the underlying container's `erase` function.
-    ///         This typically includes exceptions like those related to invalid iterators or invalid operations on the container.
-    /// \note This function may invalidate all iterators pointing to elements within the container.
+    /// Erase the range of elements with the value returned by equal_range.
+    /// \note The container is searched once, the amount of removed elements is taken from the change in size.
     /// \ingroup eraseImplementations
-    void eraseImpl(std::forward_list<value_type>& container, const value_type& value)
+    template <typename C>
+    std::size_t eraseValueWith(C& container, const value_type& value, std::integral_constant<EraseValueStrategy, EraseValueStrategy::EqualRange>)
     {
-        auto previous = container.before_begin();
-        auto current = container.begin();
+        const auto before = sizeImpl(container);
+        const auto range = container.equal_range(value);
 
-        while (current != container.end())
-        {
-            if (*current == value)
-            {
-                current = container.erase_after(previous);
-            }
-            else
-            {
-                previous = current;
-                ++current;
-            }
-        }
+        container.erase(range.first, range.second);
+        return before - sizeImpl(container);
     }
 
-    /// Removes all occurrences of a specified value specialized for std::deque.
-    /// \param container The underlying container type where the elements are erased.
-    /// \param value The value of the to be removed elements.
-    /// \pre The `container` must be a valid instance of std::deque.
-    /// \pre The `container` must not be in an invalid state or uninitialized.
-    /// \post All elements with the specified value are removed from the `container`.
-    /// \exception Any exception that may be thrown by the underlying container's `erase` function.
-    ///         This typically includes exceptions like those related to invalid iterators or invalid operations on the container.
-    /// \note This function may invalidate all iterators pointing to elements within the container.
+    /// Erase the elements with the value through the erase member of the container.
     /// \ingroup eraseImplementations
-    void eraseImpl(std::deque<value_type>& container, const value_type& value)
+    template <typename C>
+    std::size_t eraseValueWith(C& container, const value_type& value, std::integral_constant<EraseValueStrategy, EraseValueStrategy::Member>)
     {
-        for (auto it = container.begin(); it != container.end();)
-        {
-            if (*it == value)
-            {
-                while (it != container.end() - 1 && container.back() == value)
-                {
-                    container.pop_back();
-                }
-                if (it != container.end() - 1)
-                {
-                    std::iter_swap(it, container.end() - 1);
-                    container.pop_back();
-                }
-                else
-                {
-                    container.pop_back();
-                }
-            }
-            else
-            {
-                ++it;
-            }
-        }
+        return static_cast<std::size_t>(container.erase(value));
     }
 
-    /// Removes all occurrences of a specified value specialized for std::list.
-    /// \param container The underlying container type where the elements are erased.
-    /// \param value The value of the to be removed elements.
-    /// \pre The `container` must be a valid instance of std::list.
+    /// Erase the elements with the value from a contiguous container.
+    /// \note Arithmetic elements are looked up with packed compares, see SimdSearch.
+    /// \ingroup eraseImplementations
+    template <typename C>
+    std::size_t eraseValueWith(C& container, const value_type& value, std::integral_constant<EraseValueStrategy, EraseValueStrategy::Contiguous>)
+    {
+        return eraseContiguous(container, value, IsSimdSearchable<value_type>());
+    }
+
+    /// Erase the elements with the value from a random access sequence.
+    /// \note The survivors are compacted in one pass, see compactErase().
+    /// \ingroup eraseImplementations
+    template <typename C>
+    std::size_t eraseValueWith(C& container, const value_type& value, std::integral_constant<EraseValueStrategy, EraseValueStrategy::Compact>)
+    {
+        return compactErase(container, [&value](const value_type& element) { return element == value; });
+    }
+
+    /// Erase the elements with the value through the predicate based erase of the bag.
+    /// \ingroup eraseImplementations
+    template <typename C>
+    std::size_t eraseValueWith(C& container, const value_type& value, std::integral_constant<EraseValueStrategy, EraseValueStrategy::Predicate>)
+    {
+        return eraseIfImpl(container, [&value](const value_type& element) { return element == value; });
+    }
+
+    /// Removes all occurrences of a specified value specialized for std::unordered_multiset.
+    /// \param container The underlying container type where the elements are erased.
+    /// \param value The value of the to be removed elements.
+    /// \tparam H, E, A The hash function, key equality and allocator types of the std::unordered_multiset.
+    /// \return The amount of removed elements.
+    /// \pre The `container` must be a valid instance of std::unordered_multiset.
     /// \pre The `container` must not be in an invalid state or uninitialized.
     /// \post All elements with the specified value are removed from the `container`.
     /// \exception Any exception that may be thrown by the underlying container's `erase` function.
     ///         This typically includes exceptions like those related to invalid iterators or invalid operations on the container.
-    /// \note This function may invalidate all iterators pointing to elements within the container.
+    /// \note The bucket is probed once, the amount of removed elements is taken from the change in size.
+    /// \ingroup eraseImplementations
+    template <typename H, typename E, typename A>
+    std::size_t eraseImpl(std::unordered_multiset<value_type, H, E, A>& container, const value_type& value)
+    {
+        const auto before = container.size();
+        const bool lastErased = before != 0 && container.key_eq()(*this->m_last, value);
+        const auto range = container.equal_range(value);
+
+        container.erase(range.first, range.second);
+
+        if (lastErased)
+        {
+            this->resetState(container);
+        }
+        return before - container.size();
+    }
+
+    /// Removes all occurrences of a value from a contiguous container of elements that can not be compared with packed compares.
+    /// \param container The underlying container type where the elements are erased.
+    /// \param value The value of the to be removed elements.
+    /// \tparam C The contiguous container type, see IsContiguous.
+    /// \return The amount of removed elements.
+    /// \exception Any exception that may be thrown by the move assignment of the elements.
+    /// \ingroup eraseImplementations
+    template <typename C>
+    static std::size_t eraseContiguous(C& container, const value_type& value, std::false_type)
+    {
+        return compactErase(container, [&value](const value_type& element) { return element == value; });
+    }
+
+    /// Removes all occurrences of a value from a contiguous container of arithmetic elements.
+    /// Works like compactErase(), but the next removed element is looked up with SimdSearch::find().
+    /// \param container The underlying container type where the elements are erased.
+    /// \param value The value of the to be removed elements.
+    /// \tparam C The contiguous container type, see IsContiguous.
+    /// \return The amount of removed elements.
+    /// \exception noexcept No exceptions are thrown by this operation.
     /// \ingroup eraseImplementations
-    void eraseImpl(std::list<value_type>& container, const value_type& value)
+    template <typename C>
+    static std::size_t eraseContiguous(C& container, const value_type& value, std::true_type) noexcept
+    {
+        value_type* const data = container.data();
+        value_type* first = data;
+        value_type* last = data + container.size();
+
+        while (true)
+        {
+            first += SimdSearch<value_type>::find(first, last, value) - first;
+            if (first == last)
+            {
+                break;
+            }
+
+            --last;
+            while (first != last && *last == value)
+            {
+                --last;
+            }
+            if (first == last)
+            {
+                break;
+            }
+
+            *first = *last;
+            ++first;
+        }
+
+        const auto removed = static_cast<std::size_t>(data + container.size() - first);
+        container.erase(container.begin() + (first - data), container.end());
+        return removed;
+    }
+
+    /// \defgroup eraseIfImplementations Predicate based erase functionality for various underlying container types.
+
+    /// Erase the elements that satisfy a predicate from the underlying container type with the strategy chosen by ContainerStrategy.
+    /// \param container The underlying container type where the elements are erased.
+    /// \param pred The unary predicate that returns true for the removed elements.
+    /// \tparam C The underlying container type used for BagContainerAdaptor.
+    /// \tparam Predicate The type of the predicate.
+    /// \return The amount of removed elements.
+    /// \pre The `container` must be a valid instance of the specified container type.
+    /// \post All elements for which `pred` returns true are removed from the `container`.
+    /// \exception Any exception thrown by `pred` or by the move assignment of the elements.
+    /// \ingroup eraseIfImplementations
+    template <typename C, typename Predicate>
+    std::size_t eraseIfImpl(C& container, Predicate pred)
+    {
+        return eraseIfWith(container, pred, typename ContainerStrategy<C>::EraseIf());
+    }
+
+    /// Erase the elements that satisfy a predicate through the erase_if member of the container.
+    /// \ingroup eraseIfImplementations
+    template <typename C, typename Predicate>
+    std::size_t eraseIfWith(C& container, Predicate pred, std::integral_constant<EraseIfStrategy, EraseIfStrategy::Member>)
+    {
+        return static_cast<std::size_t>(container.erase_if(pred));
+    }
+
+    /// Erase the elements that satisfy a predicate from a random access sequence.
+    /// \note The survivors are compacted in one pass, see compactErase().
+    /// \ingroup eraseIfImplementations
+    template <typename C, typename Predicate>
+    std::size_t eraseIfWith(C& container, Predicate pred, std::integral_constant<EraseIfStrategy, EraseIfStrategy::Compact>)
     {
+        return compactErase(container, pred);
+    }
+
+    /// Erase the elements that satisfy a predicate one by one while walking the container.
+    /// \pre The erase member of the container must return the iterator following the erased element.
+    /// \note Only iterators to the removed elements are invalidated for node based containers.
+    /// \ingroup eraseIfImplementations
+    template <typename C, typename Predicate>
+    std::size_t eraseIfWith(C& container, Predicate pred, std::integral_constant<EraseIfStrategy, EraseIfStrategy::Iterate>)
+    {
+        std::size_t removed = 0;
+
         for (auto it = container.begin(); it != container.end();)
         {
-            if (*it == value)
+            if (pred(*it))
             {
                 it = container.erase(it);
+                ++removed;
             }
             else
             {
                 ++it;
             }
         }
+
+        return removed;
     }
 
-    /// Removes all occurrences of a specified value specialized for std::multiset.
+    /// Erase the elements that satisfy a predicate specialized for std::forward_list.
     /// \param container The underlying container type where the elements are erased.
-    /// \param value The value of the to be removed elements.
-    /// \pre The `container` must be a valid instance of std::multiset.
-    /// \pre The `container` must not be in an invalid state or uninitialized.
-    /// \post All elements with the specified value are removed from the `container`.
-    /// \exception Any exception that may be thrown by the underlying container's `erase` function.
-    ///         This typically includes exceptions like those related to invalid iterators or invalid operations on the container.
-    /// \note This function may invalidate all iterators pointing to elements within the container.
-    /// \ingroup eraseImplementations
-    void eraseImpl(std::multiset<value_type>& container, const value_type& value)
+    /// \param pred The unary predicate that returns true for the removed elements.
+    /// \tparam Predicate The type of the predicate.
+    /// \tparam A The allocator type of the std::forward_list.
+    /// \return The amount of removed elements.
+    /// \pre The `container` must be a valid instance of std::forward_list.
+    /// \post All elements for which `pred` returns true are removed from the `container`,
+    ///       the element count and the last element tracked by the adaptor are updated.
+    /// \exception Any exception thrown by `pred`.
+    /// \ingroup eraseIfImplementations
+    template <typename A, typename Predicate>
+    std::size_t eraseIfImpl(std::forward_list<value_type, A>& container, Predicate pred)
     {
-        container.erase(container.equal_range(value).first, container.equal_range(value).second);
+        const auto before = this->m_count;
+        auto previous = container.before_begin();
+        auto current = container.begin();
+
+        while (current != container.end())
+        {
+            if (pred(*current))
+            {
+                current = container.erase_after(previous);
+                --this->m_count;
+            }
+            else
+            {
+                previous = current;
+                ++current;
+            }
+        }
+
+        // The last surviving element is the new last element, which is before_begin() only for an empty list.
+        this->m_last = previous;
+        return before - this->m_count;
     }
 
-    /// Removes all occurrences of a specified value specialized for std::unordered_multiset.
+    /// Erase the elements that satisfy a predicate specialized for std::unordered_multiset.
     /// \param container The underlying container type where the elements are erased.
-    /// \param value The value of the to be removed elements.
+    /// \param pred The unary predicate that returns true for the removed elements.
+    /// \tparam Predicate The type of the predicate.
+    /// \tparam H, E, A The hash function, key equality and allocator types of the std::unordered_multiset.
+    /// \return The amount of removed elements.
     /// \pre The `container` must be a valid instance of std::unordered_multiset.
-    /// \pre The `container` must not be in an invalid state or uninitialized.
-    /// \post All elements with the specified value are removed from the `container`.
-    /// \exception Any exception that may be thrown by the underlying container's `erase` function.
-    ///         This typically includes exceptions like those related to invalid iterators or invalid operations on the container.
-    /// \note This function may invalidate all iterators pointing to elements within the container.
-    /// \ingroup eraseImplementations
-    void eraseImpl(std::unordered_multiset<value_type>& container, const value_type& value)
+    /// \post All elements for which `pred` returns true are removed from the `container`. If the implied last element
+    ///       was removed, the first element in iteration order becomes the implied last element.
+    /// \exception Any exception thrown by `pred`.
+    /// \ingroup eraseIfImplementations
+    template <typename H, typename E, typename A, typename Predicate>
+    std::size_t eraseIfImpl(std::unordered_multiset<value_type, H, E, A>& container, Predicate pred)
     {
-        container.erase(container.equal_range(value).first, container.equal_range(value).second);
+        const auto before = container.size();
+        bool lastErased = false;
+
+        for (auto it = container.begin(); it != container.end();)
+        {
+            if (pred(*it))
+            {
+                lastErased = lastErased || &*it == this->m_last;
+                it = container.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if (lastErased)
+        {
+            this->resetState(container);
+        }
+        return before - container.size();
     }
 
-    /// Removes all occurrences of a specified value specialized for std::vector.
+    /// Erase the elements that satisfy a predicate specialized for UnrolledLinkedList.
     /// \param container The underlying container type where the elements are erased.
-    /// \param value The value of the to be removed elements.
-    /// \pre The `container` must be a valid instance of std::vector.
-    /// \pre The `container` must not be in an invalid state or uninitialized.
-    /// \post All elements with the specified value are removed from the `container`.
-    /// \exception Any exception that may be thrown by the underlying container's `erase` function.
-    ///         This typically includes exceptions like those related to invalid iterators or invalid operations on the container.
-    /// \note This function may invalidate all iterators pointing to elements within the container.
-    /// \ingroup eraseImplementations
-    void eraseImpl(std::vector<value_type>& container, const value_type& value)
+    /// \param pred The unary predicate that returns true for the removed elements.
+    /// \tparam K The node capacity of the UnrolledLinkedList.
+    /// \tparam A The allocator type of the UnrolledLinkedList.
+    /// \tparam Predicate The type of the predicate.
+    /// \return The amount of removed elements.
+    /// \pre The `container` must be a valid instance of UnrolledLinkedList.
+    /// \post All elements for which `pred` returns true are removed from the `container`.
+    /// \exception Any exception thrown by `pred` or by the move assignment of the elements.
+    /// \note Every removed element is replaced by the last element, so nodes are only freed at the back
+    ///       and the remaining elements are never shifted.
+    /// \ingroup eraseIfImplementations
+    template <std::size_t K, typename A, typename Predicate>
+    std::size_t eraseIfImpl(UnrolledLinkedList<value_type, K, A>& container, Predicate pred)
     {
+        std::size_t removed = 0;
+
         for (auto it = container.begin(); it != container.end();)
         {
-            if (*it == value)
+            if (!pred(*it))
             {
-                while (it != container.end() - 1 && container.back() == value)
-                {
-                    container.pop_back();
-                }
-                if (it != container.end() - 1)
-                {
-                    std::iter_swap(it, container.end() - 1);
-                    container.pop_back();
-                }
-                else
-                {
-                    container.pop_back();
-                }
+                ++it;
+                continue;
             }
-            else
+
+            ++removed;
+            if (&*it == &container.back())
             {
-                ++it;
+                container.pop_back();
+                break;
+            }
+
+            // The moved value is tested again on the next round, `it` survives because its node is not the emptied one.
+            *it = std::move(container.back());
+            container.pop_back();
+        }
+        return removed;
+    }
+
+    /// Remove the elements that satisfy a predicate from a random access container without preserving order.
+    /// A front cursor looks for elements to remove and a back cursor looks for survivors to move into those holes,
+    /// so every element is visited once and only the survivors past the final boundary are moved.
+    /// The removed elements end up in one block at the back, which is erased with a single call.
+    /// \param container The underlying container type where the elements are erased.
+    /// \param pred The unary predicate that returns true for the removed elements.
+    /// \tparam C The underlying container type, must have random access iterators and erase at the end.
+    /// \tparam Predicate The type of the predicate.
+    /// \return The amount of removed elements.
+    /// \post All elements for which `pred` returns true are removed from the `container`.
+    /// \exception Any exception thrown by `pred` or by the move assignment of the elements.
+    /// \ingroup eraseIfImplementations
+    template <typename C, typename Predicate>
+    static std::size_t compactErase(C& container, Predicate pred)
+    {
+        auto first = container.begin();
+        auto last = container.end();
+
+        while (true)
+        {
+            while (first != last && !pred(*first))
+            {
+                ++first;
             }
+            if (first == last)
+            {
+                break;
+            }
+
+            // *first is removed, look for a survivor from the back to take its place.
+            --last;
+            while (first != last && pred(*last))
+            {
+                --last;
+            }
+            if (first == last)
+            {
+                break;
+            }
+
+            *first = std::move(*last);
+            ++first;
         }
+
+        const auto removed = static_cast<std::size_t>(container.end() - first);
+        container.erase(first, container.end());
+        return removed;
     }
 
     /// \defgroup frontImplementations Functionality for getting the implied first element for various container types.
 
-    /// Front function implementation for container types that have the front() member function in const context.
+    /// Front function implementation with the strategy chosen by ContainerStrategy in const context.
     /// \param container The underlying container type where the element is accessed.
     /// \tparam C The underlying container type used for BagContainerAdaptor.
     /// \return Reference to the implied first item in underlying container.
@@ -544,175 +1232,278 @@ private:
     template <typename C>
     const value_type& frontImpl(const C& container) const noexcept
     {
-        return container.front();
-    }
-
-    /// Front function specialization for std::forward_list in const context.
-    /// \param container The underlying container type for BagContainerAdaptor that is std::forward_list.
-    /// \return Reference to the assumed first item in underlying container.
-    /// \pre The `container` must be a valid instance of const std::forward_list, and the container must not be empty.
-    /// \exception noexcept No exceptions are thrown by this operation.
-    /// \ingroup frontImplementations
-    const value_type& frontImpl(const std::forward_list<value_type>& container) const noexcept
-    {
-        return *container.cbegin();
+        return frontWith(container, typename ContainerStrategy<C>::Front());
     }
 
-    /// Front function specialization for std::multiset in const context.
-    /// \param container The underlying container type for BagContainerAdaptor that is std::multiset.
-    /// \return Reference to the assumed first item in underlying container.
-    /// \pre The `container` must be a valid instance of const std::multiset, and the container must not be empty.
-    /// \exception noexcept No exceptions are thrown by this operation.
+    /// Front function through the front member of the container.
     /// \ingroup frontImplementations
-    const value_type& frontImpl(const std::multiset<value_type>& container) const noexcept
+    template <typename C>
+    static const value_type& frontWith(const C& container, std::integral_constant<FrontStrategy, FrontStrategy::Member>) noexcept
     {
-        return *container.cbegin();
+        return container.front();
     }
 
-    /// Front function specialization for std::unordered_multiset in const context.
-    /// \param container The underlying container type for BagContainerAdaptor that is std::unordered_multiset.
-    /// \return Reference to the assumed first item in underlying container.
-    /// \pre The `container` must be a valid instance of const std::unordered_multiset, and the container must not be empty.
-    /// \exception noexcept No exceptions are thrown by this operation.
+    /// Front function for containers without a front member, like the sorted and hashed containers.
     /// \ingroup frontImplementations
-    const value_type& frontImpl(const std::unordered_multiset<value_type>& container) const noexcept
+    template <typename C>
+    static const value_type& frontWith(const C& container, std::integral_constant<FrontStrategy, FrontStrategy::Begin>) noexcept
     {
         return *container.cbegin();
     }
 
-    // \defgroup backImplementations Functionality for getting the last element for various container types.
+    /// \defgroup backImplementations Functionality for getting the last element for various container types.
 
-    /// Back function implementation for container types that have the back() member function.
+    /// Back function implementation with the strategy chosen by ContainerStrategy.
     /// \param container The underlying container type where the element is accessed.
     /// \tparam C The underlying container type used for BagContainerAdaptor.
     /// \return Reference to the last item in underlying container.
-    /// \pre The `container` must be a valid instance of a container type that supports the back() member function, and the container must not be empty.
+    /// \pre The `container` must be a valid instance of the specified container type, and the container must not be empty.
     /// \exception noexcept No exceptions are thrown by this operation.
     /// \ingroup backImplementations
     template <typename C>
     const value_type& backImpl(const C& container) const noexcept
+    {
+        return backWith(container, typename ContainerStrategy<C>::Back());
+    }
+
+    /// Back function through the back member of the container.
+    /// \ingroup backImplementations
+    template <typename C>
+    static const value_type& backWith(const C& container, std::integral_constant<BackStrategy, BackStrategy::Member>) noexcept
     {
         return container.back();
     }
 
-    /// Back function specialization for std::forward_list.
-    /// \param container The underlying container type where the element is accessed.
-    /// \return Reference the the last item in underlying container.
-    /// \pre The `container` must be a valid instance of std::forward_list, and the container must not be empty.
-    /// \exception noexcept No exceptions are thrown by this operation.
+    /// Back function for bidirectional containers without a back member, like the sorted containers.
     /// \ingroup backImplementations
-    const value_type& backImpl(const std::forward_list<value_type>& container) const noexcept
+    template <typename C>
+    static const value_type& backWith(const C& container, std::integral_constant<BackStrategy, BackStrategy::Reverse>) noexcept
     {
-        auto itLast = container.begin();
+        return *std::prev(container.cend());
+    }
 
-        while (std::next(itLast) != container.end())
+    /// Back function for forward only containers, which are walked to their last element.
+    /// \par Time complexity:
+    /// - O(n) Where n is the amount of elements in the `container`.
+    /// \ingroup backImplementations
+    template <typename C>
+    static const value_type& backWith(const C& container, std::integral_constant<BackStrategy, BackStrategy::Linear>) noexcept
+    {
+        auto last = container.cbegin();
+        for (auto it = last; ++it != container.cend();)
         {
-            ++itLast;
+            last = it;
         }
-        return *itLast;
+        return *last;
     }
 
-    /// Back function specialization for std::multiset.
-    /// \param container The underlying container type where the element is accessed.
-    /// \return Reference to the last item in underlying container.
-    /// \pre The `container` must be a valid instance of std::multiset, and the container must not be empty.
+    /// Back function specialization for std::forward_list.
+    /// \tparam A The allocator type of the std::forward_list.
+    /// \return Reference to the last item in the underlying container, tracked by the adaptor.
+    /// \pre The container must not be empty.
     /// \exception noexcept No exceptions are thrown by this operation.
     /// \ingroup backImplementations
-    const value_type& backImpl(const std::multiset<value_type>& container) const noexcept
+    template <typename A>
+    const value_type& backImpl(const std::forward_list<value_type, A>&) const noexcept
     {
-        return *container.crbegin();
+        return *this->m_last;
     }
 
     /// Back function specialization for std::unordered_multiset.
-    /// \param container The underlying container type where the element is accessed.
-    /// \return Reference to the last item in underlying container.
-    /// \pre The `container` must be a valid instance of std::unordered_multiset, and the container must not be empty.
+    /// \tparam H, E, A The hash function, key equality and allocator types of the std::unordered_multiset.
+    /// \return Reference to the implied last item in the underlying container, designated by the adaptor.
+    /// \pre The container must not be empty.
     /// \exception noexcept No exceptions are thrown by this operation.
     /// \ingroup backImplementations
-    const value_type& backImpl(const std::unordered_multiset<value_type>& container) const noexcept
+    template <typename H, typename E, typename A>
+    const value_type& backImpl(const std::unordered_multiset<value_type, H, E, A>&) const noexcept
     {
-        auto itLast = container.cbegin();
-
-        while (std::next(itLast) != container.cend())
-        {
-            ++itLast;
-        }
-        return *itLast;
+        return *this->m_last;
     }
 
     /// \defgroup findImplementations Functionality for looking up elements in the underlying container
 
-    /// Find element from the underlying container.
+    /// Find element from the underlying container with the strategy chosen by ContainerStrategy.
     /// \param container The underlying container type where the element is looked up.
     /// \param value The value that is looked up from the container.
     /// \return Iterator to the found element if found or container.end().
-    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \exception Any exception thrown by the comparison or the hash function of the elements.
     /// \ingroup findImplementations
     template <typename C>
-    iterator findImpl(C& container, const value_type& value) noexcept
+    iterator findImpl(C& container, const value_type& value)
     {
-        return std::find(container.begin(), container.end(), value);
+        return findWith(container, value, typename ContainerStrategy<C>::Find());
     }
 
-    /// Find element from the underlying container, when the container type is std::multiset.
-    /// \param container The underlying container type that is std::multiset.
+    /// Find element from the underlying container in const context.
+    /// \param container The underlying container type where the element is looked up.
     /// \param value The value that is looked up from the container.
-    /// \return Iterator to the found element if found, or container.end().
-    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \return Constant iterator to the found element if found, or container.end().
+    /// \exception Any exception thrown by the comparison or the hash function of the elements.
     /// \ingroup findImplementations
-    iterator findImpl(std::multiset<value_type>& container, const value_type& value) noexcept
+    template <typename C>
+    const_iterator findImpl(const C& container, const value_type& value) const
     {
-        return container.find(value);
+        return findWith(container, value, typename ContainerStrategy<C>::Find());
     }
 
-    /// Find the element from the underlying container, when the container type is std::unordered_multiset.
-    /// \param container The undelying container type that is std::unordered_multiset.
-    /// \param value The value that is looked up from the container.
-    /// \return Iterator to the found element if found, or container.end().
-    /// \exception noexcept No exceptions are thrown by this operation.
+    /// Find element through the find member of the container, in constant or non-constant context.
+    /// \note Sorted and hashed containers and the containers of this library with an index look the value up
+    ///       without scanning all elements.
     /// \ingroup findImplementations
-    iterator findImpl(std::unordered_multiset<value_type>& container, const value_type& value) noexcept
+    template <typename C>
+    static auto findWith(C& container, const value_type& value, std::integral_constant<FindStrategy, FindStrategy::Member>) -> decltype(container.find(value))
     {
         return container.find(value);
     }
 
-    /// Find element from the underlying container in const context.
-    /// \param container The underlying container type where the element is looked up.
-    /// \param value The value that is looked up from the container.
-    /// \return Constant iterator to the found element if found, or container.end().
-    /// \exception noexcept No exceptions are thrown by this operation.
+    /// Find element from a contiguous container, in constant or non-constant context.
+    /// \note Arithmetic elements are compared with packed compares, see SimdSearch.
     /// \ingroup findImplementations
     template <typename C>
-    const_iterator findImpl(const C& container, const value_type& value) const noexcept
+    static auto findWith(C& container, const value_type& value, std::integral_constant<FindStrategy, FindStrategy::Contiguous>) noexcept -> decltype(container.begin())
     {
-        return std::find(container.cbegin(), container.cend(), value);
+        return container.begin() + static_cast<std::ptrdiff_t>(findOffset(container, value, IsSimdSearchable<value_type>()));
     }
 
-    /// Find element from the underlying container that is std::multiset in const context.
-    /// \param container The underlying container type where the element is looked up.
+    /// Find element with a linear search, in constant or non-constant context.
+    /// \ingroup findImplementations
+    template <typename C>
+    static auto findWith(C& container, const value_type& value, std::integral_constant<FindStrategy, FindStrategy::Linear>) noexcept -> decltype(container.begin())
+    {
+        return std::find(container.begin(), container.end(), value);
+    }
+
+    /// Get the position of the first element equal to a value in a contiguous container with a scalar loop.
+    /// \param container The contiguous container where the element is looked up.
     /// \param value The value that is looked up from the container.
-    /// \return Constant iterator to the found element if found, or container.end().
+    /// \tparam C The contiguous container type, see IsContiguous.
+    /// \return The position of the found element, or the size of the container.
     /// \exception noexcept No exceptions are thrown by this operation.
     /// \ingroup findImplementations
-    const_iterator findImpl(const std::multiset<value_type>& container, const value_type& value) const noexcept
+    template <typename C>
+    static std::size_t findOffset(const C& container, const value_type& value, std::false_type) noexcept
     {
-        return container.find(value);
+        return static_cast<std::size_t>(std::find(container.cbegin(), container.cend(), value) - container.cbegin());
     }
 
-    /// Find element from the underlying container that is std::unordered_multiset in const context.
-    /// \param container The underlying container that is const std::unordered_multiset, where the element is looked up.
+    /// Get the position of the first element equal to a value in a contiguous container with packed compares.
+    /// \param container The contiguous container of arithmetic elements where the element is looked up.
     /// \param value The value that is looked up from the container.
-    /// \return Constant iterator to the found element if found, or container.end().
+    /// \tparam C The contiguous container type, see IsContiguous.
+    /// \return The position of the found element, or the size of the container.
     /// \exception noexcept No exceptions are thrown by this operation.
     /// \ingroup findImplementations
-    const_iterator findImpl(const std::unordered_multiset<value_type>& container, const value_type& value) const noexcept
+    template <typename C>
+    static std::size_t findOffset(const C& container, const value_type& value, std::true_type) noexcept
     {
-        return container.find(value);
+        const value_type* data = container.data();
+        return static_cast<std::size_t>(SimdSearch<value_type>::find(data, data + container.size(), value) - data);
+    }
+
+    /// \defgroup countImplementations Functionality for counting elements with a value in various container types.
+
+    /// Count the elements with a value in the underlying container with the strategy chosen by ContainerStrategy.
+    /// \param container The underlying container type where the elements are counted.
+    /// \param value The value that is counted from the container.
+    /// \tparam C The underlying container type used for BagContainerAdaptor.
+    /// \return The amount of elements equal to `value`.
+    /// \exception Any exception thrown by the comparison or the hash function of the elements.
+    /// \ingroup countImplementations
+    template <typename C>
+    std::size_t countImpl(const C& container, const value_type& value) const
+    {
+        return countWith(container, value, typename ContainerStrategy<C>::Count());
+    }
+
+    /// Count the elements with a value through the count member of the container.
+    /// \ingroup countImplementations
+    template <typename C>
+    static std::size_t countWith(const C& container, const value_type& value, std::integral_constant<CountStrategy, CountStrategy::Member>)
+    {
+        return static_cast<std::size_t>(container.count(value));
+    }
+
+    /// Count the elements with a value in a contiguous container.
+    /// \note Arithmetic elements are compared with packed compares, see SimdSearch.
+    /// \ingroup countImplementations
+    template <typename C>
+    static std::size_t countWith(const C& container, const value_type& value, std::integral_constant<CountStrategy, CountStrategy::Contiguous>)
+    {
+        return countContiguous(container, value, IsSimdSearchable<value_type>());
+    }
+
+    /// Count the elements with a value with a linear scan.
+    /// \ingroup countImplementations
+    template <typename C>
+    static std::size_t countWith(const C& container, const value_type& value, std::integral_constant<CountStrategy, CountStrategy::Linear>)
+    {
+        return static_cast<std::size_t>(std::count(container.cbegin(), container.cend(), value));
+    }
+
+    /// Count the elements with a value in a contiguous container with a scalar loop.
+    /// \param container The contiguous container where the elements are counted.
+    /// \param value The value that is counted from the container.
+    /// \tparam C The contiguous container type, see IsContiguous.
+    /// \return The amount of elements equal to `value`.
+    /// \exception Any exception thrown by the comparison of the elements.
+    /// \ingroup countImplementations
+    template <typename C>
+    static std::size_t countContiguous(const C& container, const value_type& value, std::false_type)
+    {
+        return static_cast<std::size_t>(std::count(container.cbegin(), container.cend(), value));
+    }
+
+    /// Count the elements with a value in a contiguous container with packed compares.
+    /// \param container The contiguous container of arithmetic elements where the elements are counted.
+    /// \param value The value that is counted from the container.
+    /// \tparam C The contiguous container type, see IsContiguous.
+    /// \return The amount of elements equal to `value`.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \ingroup countImplementations
+    template <typename C>
+    static std::size_t countContiguous(const C& container, const value_type& value, std::true_type) noexcept
+    {
+        const value_type* data = container.data();
+        return SimdSearch<value_type>::count(data, data + container.size(), value);
+    }
+
+    /// \defgroup countIfImplementations Functionality for counting elements that satisfy a predicate in various container types.
+
+    /// Count the elements that satisfy a predicate with a linear scan of the underlying container.
+    /// \param container The underlying container type where the elements are counted.
+    /// \param pred The unary predicate that returns true for the counted elements.
+    /// \tparam C The underlying container type used for BagContainerAdaptor.
+    /// \tparam Predicate The type of the predicate.
+    /// \return The amount of elements for which `pred` returns true.
+    /// \exception Any exception thrown by `pred`.
+    /// \note Ordered and hashed containers can not use their structure for an arbitrary predicate,
+    ///       so std::multiset and std::unordered_multiset are scanned like the sequence containers.
+    /// \ingroup countIfImplementations
+    template <typename C, typename Predicate>
+    static std::size_t countIfImpl(const C& container, Predicate pred)
+    {
+        return static_cast<std::size_t>(std::count_if(container.cbegin(), container.cend(), pred));
+    }
+
+    /// Count the elements that satisfy a predicate in the underlying container type specialized for CountedMultiset.
+    /// \param container The underlying container type where the elements are counted.
+    /// \param pred The unary predicate that returns true for the counted elements.
+    /// \tparam Predicate The type of the predicate.
+    /// \tparam H, E The hash function and key equality types of the CountedMultiset.
+    /// \return The amount of elements for which `pred` returns true.
+    /// \exception Any exception thrown by `pred`.
+    /// \note `pred` is called once per distinct value, all copies of a value are counted together.
+    /// \ingroup countIfImplementations
+    template <typename H, typename E, typename Predicate>
+    static std::size_t countIfImpl(const CountedMultiset<value_type, H, E>& container, Predicate pred)
+    {
+        return static_cast<std::size_t>(container.count_if(pred));
     }
 
     /// \defgroup sizeImplementations Functionality for getting the amount of elements for various container types.
 
-    /// Get the amount of elements in the underlying container type that has size() member function.
+    /// Get the amount of elements in the underlying container type with the strategy chosen by ContainerStrategy.
     /// \param container The underlying container that we get the amount of elements from.
     /// \tparam C The underlying container type used for BagContainerAdaptor.
     /// \return The amount of elements in the underlying container type.
@@ -720,25 +1511,703 @@ private:
     /// \exception noexcept No exceptions are thrown by this operation.
     /// \ingroup sizeImplementations
     template <typename C>
-    std::size_t sizeImpl(C& container) const noexcept
+    std::size_t sizeImpl(const C& container) const noexcept
     {
-        return container.size();
+        return sizeWith(container, typename ContainerStrategy<C>::Size());
     }
 
-    /// Get the amount of elements specialized for const std::forward_list.
-    /// \param container The underlying container that we get the amount of elements from.
-    /// \return The amount of elements in the underlying container type.
-    /// \pre The `container` must be a valid instance of std::forward_list.
-    /// \exception noexcept No exceptions are thrown by this operation.
+    /// Get the amount of elements through the size member of the container.
     /// \ingroup sizeImplementations
-    std::size_t sizeImpl(const std::forward_list<value_type>& container) const noexcept
+    template <typename C>
+    static std::size_t sizeWith(const C& container, std::integral_constant<SizeStrategy, SizeStrategy::Member>) noexcept
     {
-        return std::distance(container.begin(), container.end());
+        return static_cast<std::size_t>(container.size());
     }
 
-private:
-    /// The underlying container type.
-    Container m_container;
+    /// Get the amount of elements of a container without a size member by walking it.
+    /// \par Time complexity:
+    /// - O(n) Where n is the amount of elements in the `container`.
+    /// \ingroup sizeImplementations
+    template <typename C>
+    static std::size_t sizeWith(const C& container, std::integral_constant<SizeStrategy, SizeStrategy::Distance>) noexcept
+    {
+        return static_cast<std::size_t>(std::distance(container.cbegin(), container.cend()));
+    }
+
+    /// Get the amount of elements specialized for const std::forward_list.
+    /// \tparam A The allocator type of the std::forward_list.
+    /// \return The amount of elements counted by the adaptor.
+    /// \pre The element count must have been kept up to date by every insert and erase on the container.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \ingroup sizeImplementations
+    template <typename A>
+    std::size_t sizeImpl(const std::forward_list<value_type, A>&) const noexcept
+    {
+        return this->m_count;
+    }
+
+    /// \defgroup mergeImplementations Functionality for moving the elements of another bag for various container types.
+
+    /// Move the elements of another bag into the underlying container with the strategy chosen by ContainerStrategy.
+    /// \param container The underlying container type where the elements are moved.
+    /// \param other The bag whose elements are moved, left empty.
+    /// \tparam C The underlying container type used for BagContainerAdaptor.
+    /// \exception Any exception thrown by the range insert when the elements are moved one by one.
+    /// \ingroup mergeImplementations
+    template <typename C>
+    void mergeImpl(C& container, BagContainerAdaptor& other)
+    {
+        mergeWith(container, other.m_container, typename ContainerStrategy<C>::Merge());
+        other.m_container.clear();
+        other.resetState(other.m_container);
+    }
+
+    /// Move the elements of another container by relinking its nodes, unless the nodes cannot change owner.
+    /// \ingroup mergeImplementations
+    template <typename C>
+    void mergeWith(C& container, C& source, std::integral_constant<MergeStrategy, MergeStrategy::Splice>)
+    {
+        // Nodes are deallocated by the allocator of the container that owns them at that time.
+        if (container.get_allocator() == source.get_allocator())
+        {
+            container.splice(container.cend(), source);
+            return;
+        }
+        mergeWith(container, source, std::integral_constant<MergeStrategy, MergeStrategy::Move>());
+    }
+
+    /// Move the elements of another container through the range insert of the bag.
+    /// \ingroup mergeImplementations
+    template <typename C>
+    void mergeWith(C& container, C& source, std::integral_constant<MergeStrategy, MergeStrategy::Move>)
+    {
+        insertRangeImpl(container, std::make_move_iterator(source.begin()), std::make_move_iterator(source.end()));
+    }
+
+    /// Move the elements of another bag specialized for std::forward_list.
+    /// \param container The underlying container type where the elements are moved.
+    /// \param other The bag whose elements are moved, left empty.
+    /// \tparam A The allocator type of the std::forward_list.
+    /// \post With equal allocators the nodes of `other` are relinked after the last element of the `container`,
+    ///       which is known from the bookkeeping, so the element count and the last element are updated in constant time.
+    /// \exception Any exception thrown by the range insert when the elements are moved one by one.
+    /// \ingroup mergeImplementations
+    template <typename A>
+    void mergeImpl(std::forward_list<value_type, A>& container, BagContainerAdaptor& other)
+    {
+        if (other.m_count != 0 && container.get_allocator() == other.m_container.get_allocator())
+        {
+            container.splice_after(this->m_count == 0 ? container.cbefore_begin() : this->m_last, other.m_container);
+            this->m_last = other.m_last;
+            this->m_count += other.m_count;
+        }
+        else
+        {
+            insertRangeImpl(container, std::make_move_iterator(other.m_container.begin()), std::make_move_iterator(other.m_container.end()));
+        }
+
+        other.m_container.clear();
+        other.resetState(other.m_container);
+    }
+
+private:
+    /// The underlying container type.
+    Container m_container;
+};
+
+/// BagContainerAdaptor specialized for IntrusiveList, which links elements that already live elsewhere.
+/// The bag does not own, copy or allocate its elements: inserting links the element through the IntrusiveListHook
+/// it embeds, and erasing only unlinks it. Any element can be unlinked in constant time through a reference to it.
+/// Equal elements can appear multiple times, but the same object can only be in one bag at a time.
+/// \tparam Type The type of the items, which must derive publicly from IntrusiveListHook.
+template <typename Type>
+class BagContainerAdaptor<Type, IntrusiveList<Type>>
+{
+public:
+    /// The value type of the underlying container.
+    using value_type = Type;
+
+    /// The iterator of the underlying container.
+    using iterator = typename IntrusiveList<Type>::iterator;
+
+    /// The constant iterator of the underlying container.
+    using const_iterator = typename IntrusiveList<Type>::const_iterator;
+
+    /// Default constructor.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    BagContainerAdaptor() noexcept = default;
+
+    /// Move constructor.
+    /// \param container The underlying list whose elements are relinked to the bag, left empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    BagContainerAdaptor(IntrusiveList<Type>&& container) noexcept
+        : m_container(std::move(container))
+    {
+    }
+
+    /// Move constructor.
+    /// \param other The bag whose elements are relinked to this bag, left empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    BagContainerAdaptor(BagContainerAdaptor&& other) noexcept = default;
+
+    /// Move assignment operator.
+    /// \param other The bag whose elements are relinked to this bag, left empty.
+    /// \return Reference to this bag.
+    /// \post The elements that were in this bag are unlinked.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    BagContainerAdaptor& operator=(BagContainerAdaptor&& other) noexcept = default;
+
+    /// An element can only be linked to one bag, so intrusive bags are not copyable.
+    BagContainerAdaptor(const BagContainerAdaptor&) = delete;
+
+    /// An element can only be linked to one bag, so intrusive bags are not copyable.
+    BagContainerAdaptor& operator=(const BagContainerAdaptor&) = delete;
+
+    /// Link an element to the bag.
+    /// \param element The element to be linked, which stays where it is.
+    /// \return An iterator that points to `element`.
+    /// \pre The `element` must not be linked to any bag or IntrusiveList.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1) Without allocating.
+    iterator insert(value_type& element) noexcept
+    {
+        return m_container.insert(element);
+    }
+
+    /// Link a range of elements to the bag.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam InputIt The type of the iterators, which must dereference to non-constant lvalues of `value_type`.
+    /// \pre None of the elements of the range may be linked to any bag or IntrusiveList.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert(InputIt first, InputIt last) noexcept
+    {
+        for (; first != last; ++first)
+        {
+            m_container.insert(*first);
+        }
+    }
+
+    /// Nothing is allocated by the bag, so there is nothing to reserve.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void reserve(std::size_t) noexcept
+    {
+    }
+
+    /// Unlink the element at a position.
+    /// \param elem An iterator pointing to the element to be unlinked.
+    /// \pre The `elem` iterator must be a valid dereferenceable iterator of this bag.
+    /// \post The element is unlinked and left alive, only iterators to it are invalidated.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    void erase(iterator elem) noexcept
+    {
+        m_container.erase(elem);
+    }
+
+    /// Unlink all elements with the specified value, like erase by value of the other bags.
+    /// \param value The value of the elements to be unlinked.
+    /// \return The amount of unlinked elements.
+    /// \post The elements equal to `value` are unlinked and left alive, only iterators to them are invalidated.
+    /// \exception Any exception thrown by the comparison of the elements.
+    /// \par Time complexity:
+    /// - O(n).
+    std::size_t erase(const value_type& value)
+    {
+        return erase_if([&value](const value_type& element) { return element == value; });
+    }
+
+    /// Unlink an element through a reference to it.
+    /// \param element An element linked to this bag.
+    /// \pre The `element` must be linked to this bag, see IntrusiveListHook::isLinked().
+    ///      An element that is only equal to a linked one must be unlinked through erase(const value_type&) instead.
+    /// \post The element is unlinked and left alive, only iterators to it are invalidated.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    void unlink(value_type& element) noexcept
+    {
+        m_container.erase(element);
+    }
+
+    /// Unlink all elements that satisfy the specified predicate.
+    /// \param pred The unary predicate that returns true for the elements that are unlinked.
+    /// \tparam Predicate The type of the predicate, callable with `const value_type&`.
+    /// \return The amount of unlinked elements.
+    /// \exception Any exception thrown by `pred`.
+    /// \par Time complexity:
+    /// - O(n), `pred` is called exactly once for every element.
+    template <typename Predicate>
+    std::size_t erase_if(Predicate pred)
+    {
+        const auto before = m_container.size();
+
+        for (auto it = m_container.begin(); it != m_container.end();)
+        {
+            it = pred(*it) ? m_container.erase(it) : std::next(it);
+        }
+        return before - m_container.size();
+    }
+
+    /// Swap the contents of two intrusive bags.
+    /// \param other The other bag to be swapped with.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swap(BagContainerAdaptor& other) noexcept
+    {
+        m_container.swap(other.m_container);
+    }
+
+    /// Relink all elements of another intrusive bag to this bag.
+    /// \param other The bag whose elements are relinked, left empty.
+    /// \post The elements stay where they are and iterators to them stay valid.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    void merge(BagContainerAdaptor&& other) noexcept
+    {
+        m_container.splice(m_container.cend(), other.m_container);
+    }
+
+    /// Get iterator pointing to the first element in the underlying container.
+    /// \return An iterator pointing to the first element in the underlying container.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator begin() noexcept
+    {
+        return m_container.begin();
+    }
+
+    /// Get iterator pointing to the one past the last element in the underlying container.
+    /// \return An iterator pointing one past the last element in the underlying container.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator end() noexcept
+    {
+        return m_container.end();
+    }
+
+    /// Get a constant iterator pointing to the first element in the underlying container.
+    /// \return A constant iterator pointing to the first element in the underlying container.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cbegin() const noexcept
+    {
+        return m_container.cbegin();
+    }
+
+    /// Get a constant iterator pointing one past the last element in the underlying container.
+    /// \return A contant iterator pointing one past the last element in the underlying container.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cend() const noexcept
+    {
+        return m_container.cend();
+    }
+
+    /// Get iterator pointing to a linked element with the specified value.
+    /// \param value The value to compare elements to.
+    /// \return An iterator pointing to the first element equal to `value`, or end() if there is none.
+    /// \exception Any exception thrown by the comparison of the elements.
+    iterator find(const value_type& value)
+    {
+        return std::find(m_container.begin(), m_container.end(), value);
+    }
+
+    /// Get constant iterator pointing to a linked element with the specified value in const context.
+    /// \param value The value to compare elements to.
+    /// \return A constant iterator pointing to the first element equal to `value`, or cend() if there is none.
+    /// \exception Any exception thrown by the comparison of the elements.
+    const_iterator find(const value_type& value) const
+    {
+        return std::find(m_container.cbegin(), m_container.cend(), value);
+    }
+
+    /// Get the amount of linked elements with the specified value.
+    /// \param value The value to compare elements to.
+    /// \return The amount of elements equal to `value`.
+    /// \exception Any exception thrown by the comparison of the elements.
+    std::size_t count(const value_type& value) const
+    {
+        return static_cast<std::size_t>(std::count(m_container.cbegin(), m_container.cend(), value));
+    }
+
+    /// Get the amount of linked elements that satisfy the specified predicate.
+    /// \param pred The unary predicate that returns true for the counted elements.
+    /// \tparam Predicate The type of the predicate, callable with `const value_type&`.
+    /// \return The amount of elements for which `pred` returns true.
+    /// \exception Any exception thrown by `pred`.
+    template <typename Predicate>
+    std::size_t count_if(Predicate pred) const
+    {
+        return static_cast<std::size_t>(std::count_if(m_container.cbegin(), m_container.cend(), pred));
+    }
+
+    /// Get reference to the first linked element.
+    /// \return Reference to the first element.
+    /// \pre The bag must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const value_type& front() const noexcept
+    {
+        return m_container.front();
+    }
+
+    /// Get reference to the last linked element.
+    /// \return Reference to the last element.
+    /// \pre The bag must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const value_type& back() const noexcept
+    {
+        return m_container.back();
+    }
+
+    /// Get the amount of linked elements.
+    /// \return The amount of elements in the bag.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    std::size_t size() const noexcept
+    {
+        return m_container.size();
+    }
+
+    /// Get boolean describing if the bag is empty or not.
+    /// \return Boolean describing if the bag is empty or not.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool empty() const noexcept
+    {
+        return m_container.empty();
+    }
+
+private:
+    /// The underlying list linking the elements.
+    IntrusiveList<Type> m_container;
+};
+
+/// BagContainerAdaptor specialized for SlotMap, which hands out stable handles to its elements.
+/// Inserting returns a handle instead of an iterator. The handle refers to the element until it is erased,
+/// although erasing other elements moves elements within the contiguous storage and invalidates iterators.
+/// Looking up and erasing through a handle is constant time, and iteration goes over the contiguous storage.
+/// \tparam Type The type of the items in the bag.
+template <typename Type>
+class BagContainerAdaptor<Type, SlotMap<Type>>
+{
+public:
+    /// The value type of the underlying container.
+    using value_type = Type;
+
+    /// The stable reference to an element returned by insert.
+    using handle_type = typename SlotMap<Type>::handle_type;
+
+    /// The iterator of the underlying container.
+    using iterator = typename SlotMap<Type>::iterator;
+
+    /// The constant iterator of the underlying container.
+    using const_iterator = typename SlotMap<Type>::const_iterator;
+
+    /// Default constructor.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    BagContainerAdaptor() noexcept = default;
+
+    /// Move constructor.
+    /// \param container The underlying slot map from which the bag is constructed. Its handles stay valid for the bag.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    BagContainerAdaptor(SlotMap<Type>&& container) noexcept
+        : m_container(std::move(container))
+    {
+    }
+
+    /// Insert element to the bag.
+    /// \param value The value to be inserted.
+    /// \return A handle that refers to the inserted element until it is erased.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the element.
+    /// \par Time complexity:
+    /// - Amortized O(1).
+    handle_type insert(const value_type& value)
+    {
+        return m_container.insert(value);
+    }
+
+    /// Insert element to the bag by moving it.
+    /// \param value The value to be moved into the bag.
+    /// \return A handle that refers to the inserted element until it is erased.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the move constructor of the element.
+    handle_type insert(value_type&& value)
+    {
+        return m_container.insert(std::move(value));
+    }
+
+    /// Construct element in-place in the bag.
+    /// \param args The arguments forwarded to the constructor of the element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return A handle that refers to the constructed element until it is erased.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the constructor of the element.
+    template <typename... Args>
+    handle_type emplace(Args&&... args)
+    {
+        return m_container.emplace(std::forward<Args>(args)...);
+    }
+
+    /// Insert a range of elements to the bag.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam InputIt The type of the iterators, must meet the requirements of an input iterator.
+    /// \pre [first, last) must be a valid range that does not refer to the elements of this bag.
+    /// \post All elements of the range are inserted, their handles can be looked up through iteration.
+    /// \exception std::bad_alloc if memory allocation fails.
+    template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            m_container.emplace(*first);
+        }
+    }
+
+    /// Insert elements from an initializer list to the bag.
+    /// \param list The initializer list containing the inserted values.
+    /// \exception std::bad_alloc if memory allocation fails.
+    void insert(std::initializer_list<value_type> list)
+    {
+        m_container.reserve(m_container.size() + list.size());
+        insert(list.begin(), list.end());
+    }
+
+    /// Prepare the bag to hold at least the specified amount of elements.
+    /// \param count The total amount of elements the bag is expected to hold.
+    /// \post Reaching `count` elements does not reallocate the storage or the handle table.
+    /// \exception std::length_error if `count` is too large, std::bad_alloc if memory allocation fails.
+    void reserve(std::size_t count)
+    {
+        m_container.reserve(count);
+    }
+
+    /// Remove the element that a handle refers to.
+    /// \param handle The handle of the element.
+    /// \return True if the element was removed, false if the handle was stale.
+    /// \post The handles of the other elements stay valid.
+    /// \exception Any exception thrown by the move assignment of the elements.
+    /// \par Time complexity:
+    /// - O(1).
+    bool erase(handle_type handle)
+    {
+        return m_container.erase(handle);
+    }
+
+    /// Remove the element at a position.
+    /// \param elem An iterator pointing to the element to be removed.
+    /// \pre The `elem` iterator must be a valid dereferenceable iterator of this bag.
+    /// \post The last element is moved to the position of `elem`, the handles of the other elements stay valid.
+    /// \exception Any exception thrown by the move assignment of the elements.
+    void erase(iterator elem)
+    {
+        m_container.erase(elem);
+    }
+
+    /// Erase all elements that have the specified value.
+    /// \param value The value of the elements that are removed.
+    /// \return The amount of removed elements.
+    /// \exception Any exception thrown by the comparison or the move assignment of the elements.
+    std::size_t erase(const value_type& value)
+    {
+        return m_container.erase_if([&value](const value_type& element) { return element == value; });
+    }
+
+    /// Erase all elements that satisfy the specified predicate.
+    /// \param pred The unary predicate that returns true for the elements that are removed.
+    /// \tparam Predicate The type of the predicate, callable with `const value_type&`.
+    /// \return The amount of removed elements.
+    /// \exception Any exception thrown by `pred` or by the move assignment of the elements.
+    template <typename Predicate>
+    std::size_t erase_if(Predicate pred)
+    {
+        return m_container.erase_if(pred);
+    }
+
+    /// Swap the contents of two bags.
+    /// \param other The other bag to be swapped with.
+    /// \post Handles refer to the elements in the bag that now holds them.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swap(BagContainerAdaptor& other) noexcept
+    {
+        m_container.swap(other.m_container);
+    }
+
+    /// Move all elements of another bag into this bag.
+    /// \param other The bag whose elements are moved, left empty.
+    /// \post This bag holds its own elements and the elements of `other`, `other` is empty.
+    ///       The handles of this bag stay valid. The handles of `other` become stale, the moved elements
+    ///       get new handles in this bag, which can be looked up through iteration.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the move constructor of the elements.
+    ///            `other` is then left valid but with unspecified contents.
+    /// \par Time complexity:
+    /// - O(m) Where m is the amount of elements in `other`.
+    void merge(BagContainerAdaptor&& other)
+    {
+        if (this != &other)
+        {
+            m_container.reserve(m_container.size() + other.m_container.size());
+            for (value_type& element : other.m_container)
+            {
+                m_container.emplace(std::move(element));
+            }
+            other.m_container.clear();
+        }
+    }
+
+    /// Get iterator pointing to the first element in the contiguous storage.
+    /// \return An iterator pointing to the first element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator begin() noexcept
+    {
+        return m_container.begin();
+    }
+
+    /// Get iterator pointing one past the last element in the contiguous storage.
+    /// \return An iterator pointing one past the last element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator end() noexcept
+    {
+        return m_container.end();
+    }
+
+    /// Get a constant iterator pointing to the first element in the contiguous storage.
+    /// \return A constant iterator pointing to the first element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cbegin() const noexcept
+    {
+        return m_container.cbegin();
+    }
+
+    /// Get a constant iterator pointing one past the last element in the contiguous storage.
+    /// \return A constant iterator pointing one past the last element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cend() const noexcept
+    {
+        return m_container.cend();
+    }
+
+    /// Check whether a handle refers to an element of the bag.
+    /// \param handle The handle to check.
+    /// \return True if the element of the handle has not been erased, otherwise false.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool contains(handle_type handle) const noexcept
+    {
+        return m_container.contains(handle);
+    }
+
+    /// Get iterator pointing to the element that a handle refers to.
+    /// \param handle The handle of the element.
+    /// \return An iterator pointing to the element, or end() if the handle is stale.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    iterator find(handle_type handle) noexcept
+    {
+        return m_container.find(handle);
+    }
+
+    /// Get constant iterator pointing to the element that a handle refers to in const context.
+    /// \param handle The handle of the element.
+    /// \return A constant iterator pointing to the element, or cend() if the handle is stale.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator find(handle_type handle) const noexcept
+    {
+        return m_container.find(handle);
+    }
+
+    /// Get iterator pointing to an element with the specified value.
+    /// \param value The value to compare elements to.
+    /// \return An iterator pointing to the first element equal to `value`, or end() if there is none.
+    /// \exception Any exception thrown by the comparison of the elements.
+    iterator find(const value_type& value)
+    {
+        return m_container.find(value);
+    }
+
+    /// Get constant iterator pointing to an element with the specified value in const context.
+    /// \param value The value to compare elements to.
+    /// \return A constant iterator pointing to the first element equal to `value`, or cend() if there is none.
+    /// \exception Any exception thrown by the comparison of the elements.
+    const_iterator find(const value_type& value) const
+    {
+        return m_container.find(value);
+    }
+
+    /// Get the element that a handle refers to.
+    /// \param handle The handle of the element.
+    /// \return Reference to the element.
+    /// \exception std::out_of_range if the handle is stale.
+    /// \par Time complexity:
+    /// - O(1).
+    const value_type& at(handle_type handle) const
+    {
+        return m_container.at(handle);
+    }
+
+    /// Get the handle of the element at a position, for example while iterating.
+    /// \param pos An iterator pointing to the element.
+    /// \return The handle that refers to the element.
+    /// \pre The `pos` iterator must be a valid dereferenceable iterator of this bag.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    handle_type handle(const_iterator pos) const noexcept
+    {
+        return m_container.handle(pos);
+    }
+
+    /// Get the amount of elements with the specified value.
+    /// \param value The value to compare elements to.
+    /// \return The amount of elements equal to `value`.
+    /// \exception Any exception thrown by the comparison of the elements.
+    std::size_t count(const value_type& value) const
+    {
+        return m_container.count(value);
+    }
+
+    /// Get the amount of elements that satisfy the specified predicate.
+    /// \param pred The unary predicate that returns true for the counted elements.
+    /// \tparam Predicate The type of the predicate, callable with `const value_type&`.
+    /// \return The amount of elements for which `pred` returns true.
+    /// \exception Any exception thrown by `pred`.
+    template <typename Predicate>
+    std::size_t count_if(Predicate pred) const
+    {
+        return static_cast<std::size_t>(std::count_if(m_container.cbegin(), m_container.cend(), pred));
+    }
+
+    /// Get reference to the first element in the contiguous storage.
+    /// \return Reference to the first element.
+    /// \pre The bag must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const value_type& front() const noexcept
+    {
+        return m_container.front();
+    }
+
+    /// Get reference to the last element in the contiguous storage.
+    /// \return Reference to the last element.
+    /// \pre The bag must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const value_type& back() const noexcept
+    {
+        return m_container.back();
+    }
+
+    /// Get the amount of elements in the bag.
+    /// \return The amount of elements in the bag.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    std::size_t size() const noexcept
+    {
+        return m_container.size();
+    }
+
+    /// Get boolean describing if the bag is empty or not.
+    /// \return Boolean describing if the bag is empty or not.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool empty() const noexcept
+    {
+        return m_container.empty();
+    }
+
+private:
+    /// The underlying slot map.
+    SlotMap<Type> m_container;
 };
 
 #endif
@@ -0,0 +1,486 @@
+#ifndef CONTAINER_TRAITS_HPP
+#define CONTAINER_TRAITS_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/// Maps any list of types to void, used to detect whether an expression is well formed.
+/// \tparam Ts The types that must be valid for the specialization to be selected.
+template <typename... Ts>
+struct MakeVoid
+{
+    using type = void;
+};
+
+/// Shorthand for MakeVoid, the C++14 replacement for std::void_t.
+/// \tparam Ts The types that must be valid for the specialization to be selected.
+template <typename... Ts>
+using VoidType = typename MakeVoid<Ts...>::type;
+
+/// \defgroup containerTraits Detection of the member functions and properties of a container type.
+/// Every trait is an std::integral_constant<bool>, false unless the container provides the member or property.
+
+/// Tells whether a constant container has a find member that returns a constant iterator to an element with a value.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasFind : std::false_type
+{
+};
+
+template <typename C>
+struct HasFind<C, VoidType<decltype(std::declval<const C&>().find(std::declval<const typename C::value_type&>()))>>
+    : std::is_convertible<decltype(std::declval<const C&>().find(std::declval<const typename C::value_type&>())), typename C::const_iterator>
+{
+};
+
+/// Tells whether a constant container has a count member that returns the amount of elements with a value.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasCount : std::false_type
+{
+};
+
+template <typename C>
+struct HasCount<C, VoidType<decltype(std::declval<const C&>().count(std::declval<const typename C::value_type&>()))>>
+    : std::is_integral<decltype(std::declval<const C&>().count(std::declval<const typename C::value_type&>()))>
+{
+};
+
+/// Tells whether a container has an equal_range member that returns the range of elements with a value.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasEqualRange : std::false_type
+{
+};
+
+template <typename C>
+struct HasEqualRange<C, VoidType<decltype(std::declval<C&>().equal_range(std::declval<const typename C::value_type&>()).first)>>
+    : std::true_type
+{
+};
+
+/// Tells whether a container has an erase member that removes all elements with a value and returns their amount.
+/// Members that return an iterator or a bool, which remove one element at most, are not detected.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasEraseValue : std::false_type
+{
+};
+
+template <typename C>
+struct HasEraseValue<C, VoidType<decltype(std::declval<C&>().erase(std::declval<const typename C::value_type&>()))>>
+    : std::integral_constant<bool, std::is_integral<decltype(std::declval<C&>().erase(std::declval<const typename C::value_type&>()))>::value &&
+                                       !std::is_same<decltype(std::declval<C&>().erase(std::declval<const typename C::value_type&>())), bool>::value>
+{
+};
+
+/// Tells whether a container has an erase_if member that removes the elements satisfying a predicate.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasEraseIf : std::false_type
+{
+};
+
+template <typename C>
+struct HasEraseIf<C, VoidType<decltype(std::declval<C&>().erase_if(std::declval<bool (*)(const typename C::value_type&)>()))>>
+    : std::true_type
+{
+};
+
+/// Tells whether a container has an emplace_hint member, which is how sorted and hashed containers take a position hint.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasEmplaceHint : std::false_type
+{
+};
+
+template <typename C>
+struct HasEmplaceHint<C, VoidType<decltype(std::declval<C&>().emplace_hint(std::declval<C&>().cend(), std::declval<typename C::value_type>()))>>
+    : std::true_type
+{
+};
+
+/// Tells whether a container has an emplace_back member.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasEmplaceBack : std::false_type
+{
+};
+
+template <typename C>
+struct HasEmplaceBack<C, VoidType<decltype(std::declval<C&>().emplace_back(std::declval<typename C::value_type>()))>>
+    : std::true_type
+{
+};
+
+/// Tells whether a container can insert a range before a position, like the standard sequence containers.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasPositionalRangeInsert : std::false_type
+{
+};
+
+template <typename C>
+struct HasPositionalRangeInsert<C, VoidType<decltype(std::declval<C&>().insert(std::declval<C&>().cend(), std::declval<const typename C::value_type*>(), std::declval<const typename C::value_type*>()))>>
+    : std::true_type
+{
+};
+
+/// Tells whether a container can insert a range without a position, like the standard associative containers.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasRangeInsert : std::false_type
+{
+};
+
+template <typename C>
+struct HasRangeInsert<C, VoidType<decltype(std::declval<C&>().insert(std::declval<const typename C::value_type*>(), std::declval<const typename C::value_type*>()))>>
+    : std::true_type
+{
+};
+
+/// Tells whether a container can reserve storage for an expected amount of elements.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasReserve : std::false_type
+{
+};
+
+template <typename C>
+struct HasReserve<C, VoidType<decltype(std::declval<C&>().reserve(std::size_t()))>> : std::true_type
+{
+};
+
+/// Tells whether a container has a size member. The standard containers and the containers of this library
+/// that have one answer it in constant time, std::forward_list leaves it out because it could not.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasSize : std::false_type
+{
+};
+
+template <typename C>
+struct HasSize<C, VoidType<decltype(std::declval<const C&>().size())>> : std::true_type
+{
+};
+
+/// Tells whether a constant container has a front member.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasFront : std::false_type
+{
+};
+
+template <typename C>
+struct HasFront<C, VoidType<decltype(std::declval<const C&>().front())>> : std::true_type
+{
+};
+
+/// Tells whether a constant container has a back member.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasBack : std::false_type
+{
+};
+
+template <typename C>
+struct HasBack<C, VoidType<decltype(std::declval<const C&>().back())>> : std::true_type
+{
+};
+
+/// Tells whether a container has a pop_back member.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasPopBack : std::false_type
+{
+};
+
+template <typename C>
+struct HasPopBack<C, VoidType<decltype(std::declval<C&>().pop_back())>> : std::true_type
+{
+};
+
+/// Tells whether a container can relink all elements of another container of the same type in constant time,
+/// and has an allocator to check that the nodes can change owner.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct HasSplice : std::false_type
+{
+};
+
+template <typename C>
+struct HasSplice<C, VoidType<decltype(std::declval<C&>().splice(std::declval<C&>().cend(), std::declval<C&>()),
+                                      std::declval<const C&>().get_allocator() == std::declval<const C&>().get_allocator())>>
+    : std::true_type
+{
+};
+
+/// Tells whether an allocator can free every block it handed out at once through a noexcept `bool release(std::size_t owned)`
+/// member, which returns false when blocks other than the `owned` ones are still in use. PoolAllocator is such an allocator.
+/// \tparam A The allocator type.
+/// \ingroup containerTraits
+template <typename A, typename = void>
+struct HasRelease : std::false_type
+{
+};
+
+template <typename A>
+struct HasRelease<A, VoidType<decltype(std::declval<A&>().release(std::size_t()))>>
+    : std::integral_constant<bool, std::is_convertible<decltype(std::declval<A&>().release(std::size_t())), bool>::value &&
+                                       noexcept(std::declval<A&>().release(std::size_t()))>
+{
+};
+
+/// Tells whether the iterators of a container are at least of the given category.
+/// \tparam C The container type.
+/// \tparam Category The required iterator category tag.
+/// \ingroup containerTraits
+template <typename C, typename Category>
+struct HasIteratorCategory
+    : std::is_base_of<Category, typename std::iterator_traits<typename C::iterator>::iterator_category>
+{
+};
+
+/// Tells whether a container is a random access sequence that can remove its last element,
+/// so any element can be erased by moving the last element into its place.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C>
+struct IsRandomAccessSequence
+    : std::integral_constant<bool, HasIteratorCategory<C, std::random_access_iterator_tag>::value && HasBack<C>::value && HasPopBack<C>::value>
+{
+};
+
+/// Tells whether a container stores its elements in one array, exposed by a data member.
+/// \tparam C The container type.
+/// \ingroup containerTraits
+template <typename C, typename = void>
+struct IsContiguous : std::false_type
+{
+};
+
+template <typename C>
+struct IsContiguous<C, VoidType<decltype(std::declval<C&>().data())>>
+    : std::integral_constant<bool, std::is_same<decltype(std::declval<C&>().data()), typename C::value_type*>::value &&
+                                       HasIteratorCategory<C, std::random_access_iterator_tag>::value>
+{
+};
+
+/// \defgroup containerStrategies The strategies BagContainerAdaptor chooses for a container type from its traits.
+
+/// How an element is added to the bag.
+/// \ingroup containerStrategies
+enum class InsertStrategy
+{
+    /// emplace_hint() at the end, amortized constant time for non-decreasing values in sorted containers.
+    EmplaceHint,
+    /// emplace_back(), the iterator to the new element is the one before end().
+    EmplaceBack,
+    /// emplace() without a position, for containers that decide the position themselves.
+    Emplace
+};
+
+/// How a range of elements is added to the bag.
+/// \ingroup containerStrategies
+enum class RangeInsertStrategy
+{
+    /// insert() of the range at the end, the container grows once for forward iterators.
+    Positional,
+    /// insert() of the range without a position, after reserving for forward iterators.
+    Member,
+    /// One insert per element, after reserving for forward iterators.
+    Loop
+};
+
+/// How storage is reserved.
+/// \ingroup containerStrategies
+enum class ReserveStrategy
+{
+    /// reserve() of the container.
+    Member,
+    /// Nothing, the container allocates per element or per block.
+    None
+};
+
+/// How the element at an iterator is erased.
+/// \ingroup containerStrategies
+enum class EraseStrategy
+{
+    /// The last element is moved into the hole and popped, so no elements are shifted.
+    SwapAndPop,
+    /// erase() of the container.
+    Member
+};
+
+/// How all elements with a value are erased.
+/// \ingroup containerStrategies
+enum class EraseValueStrategy
+{
+    /// The range from equal_range() is erased, the container is searched once.
+    EqualRange,
+    /// erase() of the container with the value.
+    Member,
+    /// The elements are compacted in one pass with packed compares for arithmetic types.
+    Contiguous,
+    /// The elements are compacted in one pass by moving survivors from the back into the holes.
+    Compact,
+    /// The elements are erased through the predicate based erase of the bag.
+    Predicate
+};
+
+/// How the elements satisfying a predicate are erased.
+/// \ingroup containerStrategies
+enum class EraseIfStrategy
+{
+    /// erase_if() of the container.
+    Member,
+    /// The elements are compacted in one pass by moving survivors from the back into the holes.
+    Compact,
+    /// The container is walked once and the matching elements are erased one by one.
+    Iterate
+};
+
+/// How an element with a value is looked up.
+/// \ingroup containerStrategies
+enum class FindStrategy
+{
+    /// find() of the container.
+    Member,
+    /// The array is scanned with packed compares for arithmetic types.
+    Contiguous,
+    /// std::find over the iterators.
+    Linear
+};
+
+/// How the elements with a value are counted.
+/// \ingroup containerStrategies
+enum class CountStrategy
+{
+    /// count() of the container.
+    Member,
+    /// The array is scanned with packed compares for arithmetic types.
+    Contiguous,
+    /// std::count over the iterators.
+    Linear
+};
+
+/// How the implied first element is accessed.
+/// \ingroup containerStrategies
+enum class FrontStrategy
+{
+    /// front() of the container.
+    Member,
+    /// The element at begin().
+    Begin
+};
+
+/// How the implied last element is accessed.
+/// \ingroup containerStrategies
+enum class BackStrategy
+{
+    /// back() of the container.
+    Member,
+    /// The element before end(), for bidirectional iterators.
+    Reverse,
+    /// The container is walked to its last element.
+    Linear
+};
+
+/// How the amount of elements is read.
+/// \ingroup containerStrategies
+enum class SizeStrategy
+{
+    /// size() of the container.
+    Member,
+    /// The container is walked from begin() to end().
+    Distance
+};
+
+/// How the elements of another bag are moved into the bag.
+/// \ingroup containerStrategies
+enum class MergeStrategy
+{
+    /// splice() of the container relinks the nodes when the allocators are equal.
+    Splice,
+    /// The elements are moved through the range insert of the bag.
+    Move
+};
+
+/// Selects the fastest strategy for every bag operation that the container supports.
+/// Each strategy is an std::integral_constant, so its value can be checked with static_assert
+/// and the type itself is used as the tag that selects the implementation.
+/// Containers that need bookkeeping in the bag, like std::forward_list and std::unordered_multiset,
+/// or that have a better strategy than their members suggest, are still handled by overloads of their own.
+/// Those overloads are templated on every parameter of the container but the value type, so a custom hash,
+/// comparison or allocator selects them just like the defaults do.
+/// \tparam C The container type.
+/// \ingroup containerStrategies
+template <typename C>
+struct ContainerStrategy
+{
+    using Insert = std::integral_constant<InsertStrategy,
+                                          HasEmplaceHint<C>::value   ? InsertStrategy::EmplaceHint
+                                          : HasEmplaceBack<C>::value ? InsertStrategy::EmplaceBack
+                                                                     : InsertStrategy::Emplace>;
+
+    using RangeInsert = std::integral_constant<RangeInsertStrategy,
+                                               HasPositionalRangeInsert<C>::value ? RangeInsertStrategy::Positional
+                                               : HasRangeInsert<C>::value         ? RangeInsertStrategy::Member
+                                                                                  : RangeInsertStrategy::Loop>;
+
+    using Reserve = std::integral_constant<ReserveStrategy, HasReserve<C>::value ? ReserveStrategy::Member : ReserveStrategy::None>;
+
+    using Erase = std::integral_constant<EraseStrategy, IsRandomAccessSequence<C>::value ? EraseStrategy::SwapAndPop : EraseStrategy::Member>;
+
+    using EraseValue = std::integral_constant<EraseValueStrategy,
+                                              HasEqualRange<C>::value            ? EraseValueStrategy::EqualRange
+                                              : HasEraseValue<C>::value          ? EraseValueStrategy::Member
+                                              : IsContiguous<C>::value           ? EraseValueStrategy::Contiguous
+                                              : IsRandomAccessSequence<C>::value ? EraseValueStrategy::Compact
+                                                                                 : EraseValueStrategy::Predicate>;
+
+    using EraseIf = std::integral_constant<EraseIfStrategy,
+                                           HasEraseIf<C>::value               ? EraseIfStrategy::Member
+                                           : IsRandomAccessSequence<C>::value ? EraseIfStrategy::Compact
+                                                                              : EraseIfStrategy::Iterate>;
+
+    using Find = std::integral_constant<FindStrategy,
+                                        HasFind<C>::value        ? FindStrategy::Member
+                                        : IsContiguous<C>::value ? FindStrategy::Contiguous
+                                                                 : FindStrategy::Linear>;
+
+    using Count = std::integral_constant<CountStrategy,
+                                         HasCount<C>::value       ? CountStrategy::Member
+                                         : IsContiguous<C>::value ? CountStrategy::Contiguous
+                                                                  : CountStrategy::Linear>;
+
+    using Front = std::integral_constant<FrontStrategy, HasFront<C>::value ? FrontStrategy::Member : FrontStrategy::Begin>;
+
+    using Back = std::integral_constant<BackStrategy,
+                                        HasBack<C>::value                                                   ? BackStrategy::Member
+                                        : HasIteratorCategory<C, std::bidirectional_iterator_tag>::value ? BackStrategy::Reverse
+                                                                                                            : BackStrategy::Linear>;
+
+    using Size = std::integral_constant<SizeStrategy, HasSize<C>::value ? SizeStrategy::Member : SizeStrategy::Distance>;
+
+    using Merge = std::integral_constant<MergeStrategy, HasSplice<C>::value ? MergeStrategy::Splice : MergeStrategy::Move>;
+};
+
+#endif
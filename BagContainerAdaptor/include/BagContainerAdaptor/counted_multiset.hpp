@@ -0,0 +1,514 @@
+#ifndef COUNTED_MULTISET_HPP
+#define COUNTED_MULTISET_HPP
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <unordered_map>
+#include <utility>
+
+/// CountedMultiset stores every distinct value once together with the number of its copies, so a bag with many
+/// duplicates takes memory proportional to the distinct values instead of all elements.
+/// Inserting an existing value increments its count, erasing through an iterator decrements it
+/// and erasing by value drops the value with all of its copies at once.
+/// Iteration yields each value as many times as it has copies, the copies of a value are adjacent.
+/// The elements can only be accessed through constant iterators, since modifying one copy would modify all of them.
+/// \tparam T The type of elements stored in the counted multiset.
+/// \tparam Hash The hash function for the elements, std::hash by default.
+/// \tparam KeyEqual The equality comparison for the elements, std::equal_to by default.
+template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class CountedMultiset
+{
+    /// The distinct values and the number of copies of each.
+    using CountMap = std::unordered_map<T, std::size_t, Hash, KeyEqual>;
+
+public:
+    /// The type of items stored in the counted multiset.
+    using value_type = T;
+
+    /// The type used for the amount of elements and the counts.
+    using size_type = std::size_t;
+
+    /// Forward iterator that visits every copy of every distinct value.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        /// Default constructor.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const_iterator() noexcept = default;
+
+        /// Dereference operator.
+        /// \return Reference to the value of the current copy.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        reference operator*() const noexcept
+        {
+            return m_entry->first;
+        }
+
+        /// Arrow operator.
+        /// \return Pointer to the value of the current copy.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        pointer operator->() const noexcept
+        {
+            return &m_entry->first;
+        }
+
+        /// Pre-increment operator.
+        /// \return Reference to the iterator after moving to the next copy.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const_iterator& operator++() noexcept
+        {
+            // Greater, not only equal: erasing another copy of the value may have dropped the count below the index.
+            if (++m_index >= m_entry->second)
+            {
+                ++m_entry;
+                m_index = 0;
+            }
+            return *this;
+        }
+
+        /// Post-increment operator.
+        /// \return Copy of the iterator before moving to the next copy.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const_iterator operator++(int) noexcept
+        {
+            const_iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        /// Equality operator.
+        /// \param other The iterator to compare with.
+        /// \return True if both iterators point to the same copy of the same value, or both are end iterators.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        bool operator==(const const_iterator& other) const noexcept
+        {
+            return m_entry == other.m_entry && m_index == other.m_index;
+        }
+
+        /// Inequality operator.
+        /// \param other The iterator to compare with.
+        /// \return True if the iterators point to different copies.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        bool operator!=(const const_iterator& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class CountedMultiset;
+
+        /// Constructor used by the counted multiset.
+        /// \param entry The entry of the value, the end of the map for the end iterator.
+        /// \param index Which copy of the value the iterator points to.
+        const_iterator(typename CountMap::const_iterator entry, size_type index) noexcept
+            : m_entry(entry), m_index(index)
+        {
+        }
+
+        /// The entry of the current value.
+        typename CountMap::const_iterator m_entry;
+
+        /// Which copy of the current value the iterator points to.
+        size_type m_index = 0;
+    };
+
+    /// Elements can not be modified through iterators, so iterator and const_iterator are the same type.
+    using iterator = const_iterator;
+
+    /// Default constructor.
+    /// \post Constructs an empty `CountedMultiset`.
+    CountedMultiset() = default;
+
+    /// Initializer list constructor.
+    /// \param list An initializer list containing values to initialize the counted multiset with.
+    /// \post Constructs a new `CountedMultiset` with the elements from the initializer list.
+    /// \exception std::bad_alloc if memory allocation fails.
+    CountedMultiset(std::initializer_list<T> list)
+    {
+        insert(list.begin(), list.end());
+    }
+
+    /// Copy constructor.
+    /// \param other The counted multiset to copy.
+    /// \exception std::bad_alloc if memory allocation fails.
+    CountedMultiset(const CountedMultiset& other)
+        : m_counts(other.m_counts), m_size(other.m_size), m_last(findKey(other.m_last))
+    {
+    }
+
+    /// Move constructor.
+    /// \param other The counted multiset to move from, left empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    CountedMultiset(CountedMultiset&& other) noexcept
+        : m_counts(std::move(other.m_counts)), m_size(other.m_size), m_last(other.m_last)
+    {
+        other.m_counts.clear();
+        other.m_size = 0;
+        other.m_last = nullptr;
+    }
+
+    /// Copy assignment operator.
+    /// \param other The counted multiset to copy.
+    /// \return Reference to this counted multiset.
+    /// \exception std::bad_alloc if memory allocation fails, this counted multiset is left unchanged.
+    CountedMultiset& operator=(const CountedMultiset& other)
+    {
+        if (this != &other)
+        {
+            CountedMultiset copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /// Move assignment operator.
+    /// \param other The counted multiset to move from, left empty.
+    /// \return Reference to this counted multiset.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    CountedMultiset& operator=(CountedMultiset&& other) noexcept
+    {
+        if (this != &other)
+        {
+            CountedMultiset moved(std::move(other));
+            swap(moved);
+        }
+        return *this;
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first copy of the first distinct value.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(m_counts.cbegin(), 0);
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator one past the last copy of the last distinct value.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator end() const noexcept
+    {
+        return const_iterator(m_counts.cend(), 0);
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first copy of the first distinct value.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator one past the last copy of the last distinct value.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+
+    /// Returns a constant reference to the first element in iteration order.
+    /// \return A constant reference to the first distinct value.
+    /// \pre The counted multiset must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& front() const noexcept
+    {
+        return m_counts.cbegin()->first;
+    }
+
+    /// Returns a constant reference to the most recently inserted value.
+    /// \return A constant reference to the value inserted last, or to the first distinct value
+    ///         if all copies of the value inserted last have been erased since.
+    /// \pre The counted multiset must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \note Like std::unordered_multiset, the hash order has no last element, so the insertion order is used instead.
+    const T& back() const noexcept
+    {
+        return *m_last;
+    }
+
+    /// Returns the number of elements, counting every copy.
+    /// \return The number of elements in the counted multiset.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// Returns the number of distinct values.
+    /// \return The number of distinct values, which is the number of stored entries.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    size_type distinct() const noexcept
+    {
+        return m_counts.size();
+    }
+
+    /// Checks whether the counted multiset is empty.
+    /// \return True if the counted multiset is empty, otherwise false.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /// Reserve buckets for distinct values.
+    /// \param count The amount of distinct values the counted multiset is expected to hold.
+    /// \post Inserting up to `count` distinct values does not rehash.
+    /// \exception std::bad_alloc if memory allocation fails.
+    void reserve(size_type count)
+    {
+        m_counts.reserve(count);
+    }
+
+    /// Remove all elements.
+    /// \post The counted multiset is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void clear() noexcept
+    {
+        m_counts.clear();
+        m_size = 0;
+        m_last = nullptr;
+    }
+
+    /// Construct a value and add one copy of it.
+    /// \param args The arguments forwarded to the constructor of the value.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return A constant iterator to the new copy, which is the last copy of its value.
+    /// \post The count of the value is incremented, a new entry is created for a value that was not present.
+    /// \exception std::bad_alloc if memory allocation fails, the counted multiset is left unchanged.
+    /// \note Iterators are invalidated if inserting a new distinct value rehashes.
+    /// \par Time complexity:
+    /// - Average O(1).
+    template <typename... Args>
+    const_iterator emplace(Args&&... args)
+    {
+        return add(T(std::forward<Args>(args)...));
+    }
+
+    /// Add one copy of the value.
+    /// \param value The value to be inserted, only copied if it is not present yet.
+    /// \return A constant iterator to the new copy.
+    /// \exception std::bad_alloc if memory allocation fails.
+    const_iterator insert(const T& value)
+    {
+        return add(value);
+    }
+
+    /// Add one copy of the value by moving it.
+    /// \param value The value to be inserted, only moved from if it is not present yet.
+    /// \return A constant iterator to the new copy.
+    /// \exception std::bad_alloc if memory allocation fails.
+    const_iterator insert(T&& value)
+    {
+        return add(std::move(value));
+    }
+
+    /// Add one copy of the value, the position is ignored as the copies of a value are always kept together.
+    /// \param value The value to be inserted.
+    /// \return A constant iterator to the new copy.
+    /// \exception std::bad_alloc if memory allocation fails.
+    const_iterator insert(const_iterator, const T& value)
+    {
+        return add(value);
+    }
+
+    /// Add one copy of every element of a range.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam InputIt The type of the iterators of the range.
+    /// \exception std::bad_alloc if memory allocation fails.
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            add(*first);
+        }
+    }
+
+    /// Remove one copy of the value at the position.
+    /// \param pos A constant iterator to the copy to be removed.
+    /// \return A constant iterator to the copy that followed the removed one, or end().
+    /// \pre `pos` must be a valid dereferenceable iterator of this counted multiset.
+    /// \post The count of the value is decremented, the entry is removed when no copies are left.
+    /// \post Iterators to any copy of the erased value are invalidated, except for the returned one.
+    /// \exception Any exception thrown by the hash function when the entry is removed.
+    /// \par Time complexity:
+    /// - Average O(1).
+    const_iterator erase(const_iterator pos)
+    {
+        // Erasing an empty range turns the constant map iterator into a mutable one.
+        auto entry = m_counts.erase(pos.m_entry, pos.m_entry);
+        --m_size;
+
+        if (--entry->second > 0)
+        {
+            return pos.m_index < entry->second ? pos : const_iterator(std::next(entry), 0);
+        }
+        return const_iterator(eraseEntry(entry), 0);
+    }
+
+    /// Remove all copies of the value.
+    /// \param value The value of the elements to be removed.
+    /// \return The amount of removed elements.
+    /// \exception Any exception thrown by the hash function.
+    /// \par Time complexity:
+    /// - Average O(1), independent of the amount of removed copies.
+    size_type erase(const T& value)
+    {
+        auto entry = m_counts.find(value);
+        if (entry == m_counts.end())
+        {
+            return 0;
+        }
+
+        const size_type removed = entry->second;
+        m_size -= removed;
+        eraseEntry(entry);
+        return removed;
+    }
+
+    /// Remove all elements that satisfy the predicate.
+    /// \param pred The unary predicate that returns true for the removed elements.
+    /// \tparam Predicate The type of the predicate.
+    /// \return The amount of removed elements.
+    /// \exception Any exception thrown by `pred`.
+    /// \note `pred` is called once per distinct value instead of once per element,
+    ///       all copies of a value are removed together.
+    template <typename Predicate>
+    size_type erase_if(Predicate pred)
+    {
+        const size_type before = m_size;
+
+        for (auto entry = m_counts.begin(); entry != m_counts.end();)
+        {
+            if (pred(entry->first))
+            {
+                m_size -= entry->second;
+                entry = eraseEntry(entry);
+            }
+            else
+            {
+                ++entry;
+            }
+        }
+        return before - m_size;
+    }
+
+    /// Count the elements that satisfy the predicate.
+    /// \param pred The unary predicate that returns true for the counted elements.
+    /// \tparam Predicate The type of the predicate.
+    /// \return The amount of elements for which `pred` returns true.
+    /// \exception Any exception thrown by `pred`.
+    /// \note `pred` is called once per distinct value instead of once per element,
+    ///       all copies of a value are counted together.
+    /// \par Time complexity:
+    /// - O(d), where d is the amount of distinct values.
+    template <typename Predicate>
+    size_type count_if(Predicate pred) const
+    {
+        size_type count = 0;
+        for (const auto& entry : m_counts)
+        {
+            if (pred(entry.first))
+            {
+                count += entry.second;
+            }
+        }
+        return count;
+    }
+
+    /// Find the value.
+    /// \param value The value to search for.
+    /// \return A constant iterator to the first copy of the value, or end() if there is none.
+    /// \exception Any exception thrown by the hash function.
+    /// \par Time complexity:
+    /// - Average O(1).
+    const_iterator find(const T& value) const
+    {
+        return const_iterator(m_counts.find(value), 0);
+    }
+
+    /// Count the copies of the value.
+    /// \param value The value to count.
+    /// \return The amount of elements with the value.
+    /// \exception Any exception thrown by the hash function.
+    /// \par Time complexity:
+    /// - Average O(1).
+    size_type count(const T& value) const
+    {
+        auto entry = m_counts.find(value);
+        return entry == m_counts.end() ? 0 : entry->second;
+    }
+
+    /// Swap the contents with another counted multiset.
+    /// \param other The other counted multiset to swap with.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swap(CountedMultiset& other) noexcept
+    {
+        m_counts.swap(other.m_counts);
+        std::swap(m_size, other.m_size);
+        std::swap(m_last, other.m_last);
+    }
+
+private:
+    /// Add one copy of a value, creating its entry if needed.
+    /// \param value The value, only stored if it is not present yet.
+    /// \return A constant iterator to the new copy.
+    template <typename V>
+    const_iterator add(V&& value)
+    {
+        auto entry = m_counts.find(value);
+        if (entry == m_counts.end())
+        {
+            entry = m_counts.emplace(std::forward<V>(value), 0).first;
+        }
+
+        const size_type index = entry->second++;
+        ++m_size;
+        m_last = &entry->first;
+        return const_iterator(entry, index);
+    }
+
+    /// Remove an entry and keep the most recently inserted value pointing to a live entry.
+    /// \param entry The entry to remove, its copies must already be subtracted from the size.
+    /// \return The entry following the removed one.
+    typename CountMap::iterator eraseEntry(typename CountMap::iterator entry)
+    {
+        const bool wasLast = &entry->first == m_last;
+        auto next = m_counts.erase(entry);
+
+        if (wasLast)
+        {
+            m_last = m_counts.empty() ? nullptr : &m_counts.cbegin()->first;
+        }
+        return next;
+    }
+
+    /// Look up the key equal to a value of another counted multiset.
+    /// \param value The value to look up, may be nullptr.
+    /// \return Pointer to the key in this counted multiset, or nullptr.
+    const T* findKey(const T* value) const
+    {
+        return value ? &m_counts.find(*value)->first : nullptr;
+    }
+
+    /// The distinct values and their counts.
+    CountMap m_counts;
+
+    /// The total amount of copies.
+    size_type m_size = 0;
+
+    /// The key of the most recently inserted value, keys are never moved by rehashing.
+    const T* m_last = nullptr;
+};
+
+#endif
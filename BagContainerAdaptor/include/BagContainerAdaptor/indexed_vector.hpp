@@ -0,0 +1,361 @@
+#ifndef INDEXED_VECTOR_HPP
+#define INDEXED_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// IndexedVector stores its elements contiguously like std::vector and keeps a hash index from each value
+/// to the slots holding it, which makes looking up, counting and erasing by value constant time on average.
+/// Elements are erased by moving the last element into the hole, the index follows the moved element.
+/// The elements can only be accessed through constant iterators, since modifying them would break the index.
+/// \tparam T The type of elements stored in the indexed vector.
+/// \tparam Hash The hash function for the elements, std::hash by default.
+/// \tparam KeyEqual The equality comparison for the elements, std::equal_to by default.
+template <typename T, typename Hash = std::hash<T>, typename KeyEqual = std::equal_to<T>>
+class IndexedVector
+{
+public:
+    /// The type of items stored in the indexed vector.
+    using value_type = T;
+
+    /// The type used for the amount of elements and the slot numbers.
+    using size_type = std::size_t;
+
+    /// The constant iterator of the contiguous storage.
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    /// Elements can not be modified through iterators, so iterator and const_iterator are the same type.
+    using iterator = const_iterator;
+
+    /// Default constructor.
+    /// \post Constructs an empty `IndexedVector`.
+    IndexedVector() = default;
+
+    /// Initializer list constructor.
+    /// \param list An initializer list containing values to initialize the indexed vector with.
+    /// \post Constructs a new `IndexedVector` with the elements from the initializer list.
+    /// \exception std::bad_alloc if memory allocation fails.
+    IndexedVector(std::initializer_list<T> list)
+    {
+        insert(list.begin(), list.end());
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first element in the contiguous storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator begin() const noexcept
+    {
+        return m_values.cbegin();
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator one past the last element in the contiguous storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator end() const noexcept
+    {
+        return m_values.cend();
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first element in the contiguous storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cbegin() const noexcept
+    {
+        return m_values.cbegin();
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator one past the last element in the contiguous storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cend() const noexcept
+    {
+        return m_values.cend();
+    }
+
+    /// Returns a constant reference to the first element.
+    /// \return A constant reference to the first element.
+    /// \pre The indexed vector must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& front() const noexcept
+    {
+        return m_values.front();
+    }
+
+    /// Returns a constant reference to the last element.
+    /// \return A constant reference to the last element.
+    /// \pre The indexed vector must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& back() const noexcept
+    {
+        return m_values.back();
+    }
+
+    /// Returns the number of elements.
+    /// \return The number of elements in the indexed vector.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    size_type size() const noexcept
+    {
+        return m_values.size();
+    }
+
+    /// Checks whether the indexed vector is empty.
+    /// \return True if the indexed vector is empty, otherwise false.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool empty() const noexcept
+    {
+        return m_values.empty();
+    }
+
+    /// Reserve storage for the elements and the index.
+    /// \param count The amount of elements the indexed vector is expected to hold.
+    /// \post Inserting up to `count` elements does not reallocate the storage or rehash the index.
+    /// \exception std::length_error if `count` is too large, std::bad_alloc if memory allocation fails.
+    void reserve(size_type count)
+    {
+        m_values.reserve(count);
+        m_positions.reserve(count);
+        m_index.reserve(count);
+    }
+
+    /// Remove all elements.
+    /// \post The indexed vector is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void clear() noexcept
+    {
+        m_values.clear();
+        m_positions.clear();
+        m_index.clear();
+    }
+
+    /// Construct a new element at the end of the storage and index it.
+    /// \param args The arguments forwarded to the constructor of the element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return A constant iterator to the new element.
+    /// \post The element is the last one in the storage and can be looked up by its value.
+    /// \exception std::bad_alloc if memory allocation fails, the indexed vector is left unchanged.
+    /// \note Iterators are invalidated if the storage reallocates.
+    template <typename... Args>
+    const_iterator emplace(Args&&... args)
+    {
+        m_values.emplace_back(std::forward<Args>(args)...);
+        const size_type slot = m_values.size() - 1;
+
+        try
+        {
+            m_positions.push_back(0);
+            auto& slots = m_index[m_values.back()];
+            m_positions.back() = slots.size();
+            slots.push_back(slot);
+        }
+        catch (...)
+        {
+            auto entry = m_index.find(m_values.back());
+            if (entry != m_index.end() && entry->second.empty())
+            {
+                m_index.erase(entry);
+            }
+            m_positions.resize(slot);
+            m_values.pop_back();
+            throw;
+        }
+
+        return m_values.cbegin() + static_cast<std::ptrdiff_t>(slot);
+    }
+
+    /// Insert a copy of the value.
+    /// \param value The value to be inserted.
+    /// \return A constant iterator to the new element.
+    /// \exception std::bad_alloc if memory allocation fails.
+    const_iterator insert(const T& value)
+    {
+        return emplace(value);
+    }
+
+    /// Insert the value by moving it.
+    /// \param value The value to be moved into the indexed vector.
+    /// \return A constant iterator to the new element.
+    /// \exception std::bad_alloc if memory allocation fails.
+    const_iterator insert(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /// Insert a copy of the value, the position is ignored as elements are always appended.
+    /// \param value The value to be inserted.
+    /// \return A constant iterator to the new element.
+    /// \exception std::bad_alloc if memory allocation fails.
+    const_iterator insert(const_iterator, const T& value)
+    {
+        return emplace(value);
+    }
+
+    /// Insert the elements of a range.
+    /// \param first An iterator pointing to the first element of the range.
+    /// \param last An iterator pointing one past the last element of the range.
+    /// \tparam InputIt The type of the iterators of the range.
+    /// \exception std::bad_alloc if memory allocation fails.
+    template <typename InputIt>
+    void insert(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+        {
+            emplace(*first);
+        }
+    }
+
+    /// Erase the element at the position by moving the last element into its place.
+    /// \param pos A constant iterator to the element to be removed.
+    /// \return A constant iterator to the same slot, which now holds the previously last element, or end().
+    /// \pre `pos` must be a valid dereferenceable iterator of this indexed vector.
+    /// \exception Any exception thrown by the hash function or the move assignment of the elements.
+    /// \par Time complexity:
+    /// - Average O(1).
+    const_iterator erase(const_iterator pos)
+    {
+        const auto slot = static_cast<size_type>(pos - m_values.cbegin());
+        eraseSlot(slot);
+        return m_values.cbegin() + static_cast<std::ptrdiff_t>(slot);
+    }
+
+    /// Erase all elements with the value.
+    /// \param value The value of the elements to be removed.
+    /// \return The amount of removed elements.
+    /// \exception Any exception thrown by the hash function or the move assignment of the elements.
+    /// \par Time complexity:
+    /// - Average O(k log k) Where k is the amount of removed elements, independent of the size of the indexed vector.
+    size_type erase(const T& value)
+    {
+        auto entry = m_index.find(value);
+        if (entry == m_index.end())
+        {
+            return 0;
+        }
+
+        std::vector<size_type> slots = std::move(entry->second);
+        m_index.erase(entry);
+
+        // Going from the highest slot down, the element moved into a hole is never one of the removed ones.
+        std::sort(slots.begin(), slots.end(), std::greater<size_type>());
+        for (size_type slot : slots)
+        {
+            removeSlot(slot);
+        }
+        return slots.size();
+    }
+
+    /// Erase all elements that satisfy the predicate.
+    /// \param pred The unary predicate that returns true for the removed elements.
+    /// \tparam Predicate The type of the predicate.
+    /// \return The amount of removed elements.
+    /// \exception Any exception thrown by `pred`, the hash function or the move assignment of the elements.
+    template <typename Predicate>
+    size_type erase_if(Predicate pred)
+    {
+        const size_type before = m_values.size();
+
+        // Walking backwards, the element moved into a hole has already been tested.
+        for (size_type slot = m_values.size(); slot-- > 0;)
+        {
+            if (pred(m_values[slot]))
+            {
+                eraseSlot(slot);
+            }
+        }
+        return before - m_values.size();
+    }
+
+    /// Find an element with the value.
+    /// \param value The value to search for.
+    /// \return A constant iterator to an element with the value, or end() if there is none.
+    /// \exception Any exception thrown by the hash function.
+    /// \par Time complexity:
+    /// - Average O(1).
+    const_iterator find(const T& value) const
+    {
+        auto entry = m_index.find(value);
+        if (entry == m_index.end())
+        {
+            return m_values.cend();
+        }
+        return m_values.cbegin() + static_cast<std::ptrdiff_t>(entry->second.front());
+    }
+
+    /// Count the elements with the value.
+    /// \param value The value to count.
+    /// \return The amount of elements with the value.
+    /// \exception Any exception thrown by the hash function.
+    /// \par Time complexity:
+    /// - Average O(1).
+    size_type count(const T& value) const
+    {
+        auto entry = m_index.find(value);
+        return entry == m_index.end() ? 0 : entry->second.size();
+    }
+
+    /// Swap the contents with another indexed vector.
+    /// \param other The other indexed vector to swap with.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swap(IndexedVector& other) noexcept
+    {
+        m_values.swap(other.m_values);
+        m_positions.swap(other.m_positions);
+        m_index.swap(other.m_index);
+    }
+
+private:
+    /// Remove an element from the index and then from the storage.
+    /// \param slot The slot of the removed element.
+    void eraseSlot(size_type slot)
+    {
+        auto entry = m_index.find(m_values[slot]);
+        auto& slots = entry->second;
+
+        // Swap-and-pop the slot out of the list of slots holding this value.
+        const size_type position = m_positions[slot];
+        const size_type movedSlot = slots.back();
+        slots[position] = movedSlot;
+        m_positions[movedSlot] = position;
+        slots.pop_back();
+
+        if (slots.empty())
+        {
+            m_index.erase(entry);
+        }
+
+        removeSlot(slot);
+    }
+
+    /// Remove an element that is no longer indexed from the storage by moving the last element into its slot.
+    /// \param slot The slot of the removed element.
+    /// \pre The last element must still be indexed, unless it is the removed element.
+    void removeSlot(size_type slot)
+    {
+        const size_type last = m_values.size() - 1;
+
+        if (slot != last)
+        {
+            m_values[slot] = std::move(m_values[last]);
+            m_positions[slot] = m_positions[last];
+            m_index.find(m_values[slot])->second[m_positions[slot]] = slot;
+        }
+
+        m_values.pop_back();
+        m_positions.pop_back();
+    }
+
+    /// The elements in contiguous storage.
+    std::vector<T> m_values;
+
+    /// For every slot, the position of the slot in the list of slots of its value.
+    std::vector<size_type> m_positions;
+
+    /// The slots holding each value.
+    std::unordered_map<T, std::vector<size_type>, Hash, KeyEqual> m_index;
+};
+
+#endif
@@ -0,0 +1,504 @@
+#ifndef INTRUSIVE_LIST_HPP
+#define INTRUSIVE_LIST_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/// The links that an element of IntrusiveList carries inside itself.
+/// A type is stored in IntrusiveList by deriving publicly from this hook, so linking and unlinking
+/// the element only rewires pointers and never allocates or copies the element.
+/// Copying an element gives the copy an unlinked hook, and assigning an element keeps the links of the target.
+struct IntrusiveListHook
+{
+    /// Default constructor.
+    /// \post The hook is not linked to any list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    IntrusiveListHook() noexcept = default;
+
+    /// Copy constructor.
+    /// \post The hook is not linked to any list, regardless of the copied hook.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    IntrusiveListHook(const IntrusiveListHook&) noexcept
+    {
+    }
+
+    /// Copy assignment operator.
+    /// \return A reference to this hook, which keeps its own links.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    IntrusiveListHook& operator=(const IntrusiveListHook&) noexcept
+    {
+        return *this;
+    }
+
+    /// Checks whether the element is currently in a list.
+    /// \return True if the hook is linked to a list, otherwise false.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool isLinked() const noexcept
+    {
+        return m_next != nullptr;
+    }
+
+    /// Pointing towards the previous hook in the list, nullptr while unlinked.
+    IntrusiveListHook* m_prev = nullptr;
+
+    /// Pointing towards the next hook in the list, nullptr while unlinked.
+    IntrusiveListHook* m_next = nullptr;
+};
+
+/// This doubly linked list links elements that live elsewhere, for example in an object pool, through the
+/// IntrusiveListHook embedded in each element. The list does not own the elements: inserting links the element
+/// itself, erasing only unlinks it, and neither of them allocates. An element can be in one list at a time.
+/// The hooks form a ring through a sentinel hook owned by the list, so no operation has to check for the ends.
+/// \tparam T The type of elements, which must derive publicly from IntrusiveListHook.
+/// \pre Every element must be erased from the list before it is destroyed.
+template <typename T>
+class IntrusiveList
+{
+    static_assert(std::is_base_of<IntrusiveListHook, T>::value, "IntrusiveList elements must derive from IntrusiveListHook.");
+
+    /// Bidirectional iterator over the linked elements.
+    /// \tparam IsConst Whether the elements are accessed as const.
+    template <bool IsConst>
+    class BasicIterator
+    {
+        using HookPointer = typename std::conditional<IsConst, const IntrusiveListHook*, IntrusiveListHook*>::type;
+
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        /// Default constructor.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator() noexcept = default;
+
+        /// Conversion from an iterator to a constant iterator.
+        /// \param other The non-constant iterator.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            : m_hook(other.m_hook)
+        {
+        }
+
+        /// Dereference operator.
+        /// \return Reference to the current element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        reference operator*() const noexcept
+        {
+            return static_cast<reference>(*m_hook);
+        }
+
+        /// Arrow operator.
+        /// \return Pointer to the current element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        pointer operator->() const noexcept
+        {
+            return static_cast<pointer>(m_hook);
+        }
+
+        /// Pre-increment operator.
+        /// \return Reference to the iterator after moving to the next element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator& operator++() noexcept
+        {
+            m_hook = m_hook->m_next;
+            return *this;
+        }
+
+        /// Post-increment operator.
+        /// \return Copy of the iterator before moving to the next element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator operator++(int) noexcept
+        {
+            BasicIterator previous = *this;
+            m_hook = m_hook->m_next;
+            return previous;
+        }
+
+        /// Pre-decrement operator.
+        /// \return Reference to the iterator after moving to the previous element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator& operator--() noexcept
+        {
+            m_hook = m_hook->m_prev;
+            return *this;
+        }
+
+        /// Post-decrement operator.
+        /// \return Copy of the iterator before moving to the previous element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator operator--(int) noexcept
+        {
+            BasicIterator next = *this;
+            m_hook = m_hook->m_prev;
+            return next;
+        }
+
+        /// Equality operator.
+        /// \param other The iterator to compare with.
+        /// \return True if both iterators point to the same element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        bool operator==(const BasicIterator& other) const noexcept
+        {
+            return m_hook == other.m_hook;
+        }
+
+        /// Inequality operator.
+        /// \param other The iterator to compare with.
+        /// \return True if the iterators point to different elements.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        bool operator!=(const BasicIterator& other) const noexcept
+        {
+            return m_hook != other.m_hook;
+        }
+
+    private:
+        friend class IntrusiveList;
+
+        template <bool>
+        friend class BasicIterator;
+
+        /// Constructor used by the list.
+        /// \param hook The hook of the element, or the sentinel for the end iterator.
+        explicit BasicIterator(HookPointer hook) noexcept
+            : m_hook(hook)
+        {
+        }
+
+        /// The hook of the current element.
+        HookPointer m_hook = nullptr;
+    };
+
+public:
+    /// The type of items linked in the list.
+    using value_type = T;
+
+    /// A bidirectional iterator for traversing elements in the list.
+    using iterator = BasicIterator<false>;
+
+    /// A constant bidirectional iterator for traversing elements in the list.
+    using const_iterator = BasicIterator<true>;
+
+    /// Default constructor.
+    /// \post Constructs an empty list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    IntrusiveList() noexcept
+    {
+        m_sentinel.m_prev = &m_sentinel;
+        m_sentinel.m_next = &m_sentinel;
+    }
+
+    /// Destructor.
+    /// \post Unlinks all elements, which are left alive and can be inserted to another list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    ~IntrusiveList() noexcept
+    {
+        clear();
+    }
+
+    /// An element can only be linked to one list, so lists are not copyable.
+    IntrusiveList(const IntrusiveList&) = delete;
+
+    /// An element can only be linked to one list, so lists are not copyable.
+    IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+    /// Move constructor.
+    /// \param other The list whose elements are relinked to this list, left empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    IntrusiveList(IntrusiveList&& other) noexcept
+        : IntrusiveList()
+    {
+        swap(other);
+    }
+
+    /// Move assignment operator.
+    /// \param other The list whose elements are relinked to this list, left empty.
+    /// \return A reference to this list.
+    /// \post The elements that were in this list are unlinked.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    IntrusiveList& operator=(IntrusiveList&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /// Get an iterator to the first element.
+    /// \return An iterator to the first element, or end() if the list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator begin() noexcept
+    {
+        return iterator(m_sentinel.m_next);
+    }
+
+    /// Get an iterator past the last element.
+    /// \return An iterator that acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator end() noexcept
+    {
+        return iterator(&m_sentinel);
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first element, or end() if the list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator that acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first element, or cend() if the list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(m_sentinel.m_next);
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator that acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(&m_sentinel);
+    }
+
+    /// Get an iterator to an element from a reference to it.
+    /// \param element An element linked to this list.
+    /// \return An iterator pointing to `element`.
+    /// \pre The `element` must be linked to this list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator iterator_to(T& element) noexcept
+    {
+        return iterator(&element);
+    }
+
+    /// Get a constant iterator to an element from a reference to it.
+    /// \param element An element linked to this list.
+    /// \return A constant iterator pointing to `element`.
+    /// \pre The `element` must be linked to this list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator iterator_to(const T& element) const noexcept
+    {
+        return const_iterator(&element);
+    }
+
+    /// Link an element at the end of the list.
+    /// \param element The element to be linked, which stays where it is.
+    /// \return An iterator that points to `element`.
+    /// \pre The `element` must not be linked to any list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    iterator insert(T& element) noexcept
+    {
+        return insert(end(), element);
+    }
+
+    /// Link an element in front of a position.
+    /// \param pos An iterator pointing to the position where the element is linked.
+    /// \param element The element to be linked, which stays where it is.
+    /// \return An iterator that points to `element`.
+    /// \pre The `element` must not be linked to any list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    iterator insert(const_iterator pos, T& element) noexcept
+    {
+        IntrusiveListHook* next = const_cast<IntrusiveListHook*>(pos.m_hook);
+        IntrusiveListHook* hook = &element;
+
+        hook->m_prev = next->m_prev;
+        hook->m_next = next;
+        next->m_prev->m_next = hook;
+        next->m_prev = hook;
+        ++m_count;
+        return iterator(hook);
+    }
+
+    /// Relink all elements of another list in front of a position.
+    /// \param pos An iterator pointing to the position where the elements are linked.
+    /// \param other The list whose elements are relinked, left empty.
+    /// \post The elements of `other` are linked in their original order in front of `pos`, iterators to them stay valid.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    void splice(const_iterator pos, IntrusiveList& other) noexcept
+    {
+        if (this == &other || other.m_count == 0)
+        {
+            return;
+        }
+
+        IntrusiveListHook* next = const_cast<IntrusiveListHook*>(pos.m_hook);
+        IntrusiveListHook* first = other.m_sentinel.m_next;
+        IntrusiveListHook* last = other.m_sentinel.m_prev;
+
+        first->m_prev = next->m_prev;
+        last->m_next = next;
+        next->m_prev->m_next = first;
+        next->m_prev = last;
+        m_count += other.m_count;
+
+        other.m_count = 0;
+        other.relinkSentinel();
+    }
+
+    /// Unlink the element at a position.
+    /// \param pos An iterator pointing to the element to be unlinked.
+    /// \return An iterator that points to the element following the unlinked element.
+    /// \pre The provided iterator must be valid and dereferenceable.
+    /// \post The element is unlinked and left alive, only iterators to it are invalidated.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    iterator erase(const_iterator pos) noexcept
+    {
+        IntrusiveListHook* hook = const_cast<IntrusiveListHook*>(pos.m_hook);
+        IntrusiveListHook* next = hook->m_next;
+
+        hook->m_prev->m_next = next;
+        next->m_prev = hook->m_prev;
+        hook->m_prev = nullptr;
+        hook->m_next = nullptr;
+        --m_count;
+        return iterator(next);
+    }
+
+    /// Unlink an element through a reference to it.
+    /// \param element An element linked to this list.
+    /// \return An iterator that points to the element following the unlinked element.
+    /// \pre The `element` must be linked to this list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    iterator erase(T& element) noexcept
+    {
+        return erase(iterator_to(element));
+    }
+
+    /// Unlink all elements.
+    /// \post The list is empty and the elements can be inserted to another list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(n) Where n is the amount of elements, since every hook is reset.
+    void clear() noexcept
+    {
+        IntrusiveListHook* hook = m_sentinel.m_next;
+        while (hook != &m_sentinel)
+        {
+            IntrusiveListHook* next = hook->m_next;
+            hook->m_prev = nullptr;
+            hook->m_next = nullptr;
+            hook = next;
+        }
+
+        m_sentinel.m_prev = &m_sentinel;
+        m_sentinel.m_next = &m_sentinel;
+        m_count = 0;
+    }
+
+    /// Returns a reference to the first element.
+    /// \return A reference to the first element.
+    /// \pre The list must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    T& front() noexcept
+    {
+        return *begin();
+    }
+
+    /// Returns a constant reference to the first element.
+    /// \return A constant reference to the first element.
+    /// \pre The list must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& front() const noexcept
+    {
+        return *begin();
+    }
+
+    /// Returns a reference to the last element.
+    /// \return A reference to the last element.
+    /// \pre The list must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    T& back() noexcept
+    {
+        return static_cast<T&>(*m_sentinel.m_prev);
+    }
+
+    /// Returns a constant reference to the last element.
+    /// \return A constant reference to the last element.
+    /// \pre The list must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& back() const noexcept
+    {
+        return static_cast<const T&>(*m_sentinel.m_prev);
+    }
+
+    /// Returns the number of linked elements.
+    /// \return The number of elements in the list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    std::size_t size() const noexcept
+    {
+        return m_count;
+    }
+
+    /// Checks whether the list is empty.
+    /// \return True if the list is empty, otherwise false.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool empty() const noexcept
+    {
+        return m_count == 0;
+    }
+
+    /// Swap the elements of this list with another list.
+    /// \param other The other list to swap with.
+    /// \post The first and last elements of both lists are relinked to the sentinel of the other list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swap(IntrusiveList& other) noexcept
+    {
+        std::swap(m_sentinel.m_prev, other.m_sentinel.m_prev);
+        std::swap(m_sentinel.m_next, other.m_sentinel.m_next);
+        std::swap(m_count, other.m_count);
+        other.relinkSentinel();
+        relinkSentinel();
+    }
+
+private:
+    /// Point the first and last elements back to the sentinel of this list after the ring was taken over.
+    void relinkSentinel() noexcept
+    {
+        if (m_count == 0)
+        {
+            m_sentinel.m_prev = &m_sentinel;
+            m_sentinel.m_next = &m_sentinel;
+            return;
+        }
+
+        m_sentinel.m_next->m_prev = &m_sentinel;
+        m_sentinel.m_prev->m_next = &m_sentinel;
+    }
+
+    /// The hook before the first element and after the last element, its links point to itself while the list is empty.
+    IntrusiveListHook m_sentinel;
+
+    /// Amount of linked elements.
+    std::size_t m_count = 0;
+};
+
+#endif
@@ -1,7 +1,16 @@
 #ifndef LINKED_LIST_HPP
 #define LINKED_LIST_HPP
 
+#include "container_traits.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 /// LinkedListNode represents a single node in the linked list.
 /// \tparam T The type of data stored in the node.
@@ -9,11 +18,13 @@ template <typename T>
 struct LinkedListNode
 {
     /// Constructor.
-    /// \param value The value of the data in the Node.
-    /// \post The `m_data` is initialized with value.
-    /// \exception noexcept No exceptions are thrown by this operation.
-    explicit LinkedListNode(const T& value) noexcept
-        : m_data(value)
+    /// \param args The arguments forwarded to the constructor of the data in the Node.
+    /// \tparam Args The types of the constructor arguments.
+    /// \post The `m_data` is constructed from `args`.
+    /// \exception Any exception thrown by the constructor of the data.
+    template <typename... Args>
+    explicit LinkedListNode(Args&&... args) noexcept(std::is_nothrow_constructible<T, Args&&...>::value)
+        : m_data(std::forward<Args>(args)...)
     {
     }
 
@@ -27,7 +38,7 @@ struct LinkedListNode
     LinkedListNode<T>* m_inverse = nullptr;
 };
 
-/// This doubly linked list contains basic functionality for container and four different forward iterator types.
+/// This doubly linked list contains basic functionality for container and four different bidirectional iterator types.
 /// \tparam T The type of elements stored in the linked list.
 /// \tparam Allocator The type of allocator used in this linked list,
 /// initialized as std::allocator by default.
@@ -38,13 +49,13 @@ public:
     /// The type of items stored in the linked list.
     using value_type = T;
 
-    /// A forward iterator for traversing elements in the linked list.
+    /// A bidirectional iterator for traversing elements in the linked list.
     class iterator : public std::iterator<
-                         std::forward_iterator_tag,
-                         LinkedListNode<T>,
+                         std::bidirectional_iterator_tag,
+                         T,
                          std::ptrdiff_t,
-                         LinkedListNode<T>*,
-                         LinkedListNode<T>&>
+                         T*,
+                         T&>
     {
     public:
         /// Default constructor.
@@ -55,10 +66,11 @@ public:
 
         /// Constructor.
         /// \param node Pointer to the `LinkedListNode` to initialize the iterator with.
+        /// \param list The linked list that is traversed, used for stepping back from the end.
         /// \post The iterator is constructed with the given `LinkedListNode` as the current node.
         /// \exception noexcept No exceptions are thrown by this operation.
-        explicit iterator(LinkedListNode<T>* node) noexcept
-            : m_currentNode(node)
+        iterator(LinkedListNode<T>* node, const LinkedList* list) noexcept
+            : m_currentNode(node), m_list(list)
         {
         }
 
@@ -101,6 +113,29 @@ public:
             return temp;
         }
 
+        /// Pre-decrement operator for the iterator.
+        /// \return A reference to the iterator after the decrement.
+        /// \pre The iterator is not the first one of the traversal.
+        /// \post Moves the iterator to the previous node in the linked list, or from the end to the last node.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        iterator& operator--() noexcept
+        {
+            m_currentNode = m_currentNode ? m_currentNode->m_inverse : m_list->m_tail;
+            return *this;
+        }
+
+        /// Post-decrement operator for the iterator.
+        /// \return A iterator pointing to the position before the decrement.
+        /// \pre The iterator is not the first one of the traversal.
+        /// \post Moves the iterator to the previous node in the linked list, or from the end to the last node.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        iterator operator--(int) noexcept
+        {
+            iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
         /// Equality comparison operator for the iterator.
         /// \param other The iterator to compare with.
         /// \return True if both iterators point to the same node, otherwise false.
@@ -125,8 +160,8 @@ public:
         /// \param it The constant iterator to copy construct from.
         /// \post The iterator is constructed with the same current node as the constant iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        iterator(const typename LinkedList<T>::const_iterator& it) noexcept
-            : m_currentNode(const_cast<LinkedListNode<T>*>(it.getNode()))
+        iterator(const typename LinkedList::const_iterator& it) noexcept
+            : m_currentNode(const_cast<LinkedListNode<T>*>(it.getNode())), m_list(it.getList())
         {
         }
 
@@ -135,9 +170,10 @@ public:
         /// \return A reference to the iterator after the assignment.
         /// \post The iterator is assigned with the same current node as the constant iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        iterator& operator=(const typename LinkedList<T>::const_iterator& it) noexcept
+        iterator& operator=(const typename LinkedList::const_iterator& it) noexcept
         {
             m_currentNode = const_cast<LinkedListNode<T>*>(it.getNode());
+            m_list = it.getList();
             return *this;
         }
 
@@ -145,8 +181,8 @@ public:
         /// \param it The constant iterator to move construct from.
         /// \post The iterator is constructed with the same current node as the constant iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        iterator(typename LinkedList<T>::const_iterator&& it) noexcept
-            : m_currentNode(const_cast<LinkedListNode<T>*>(it.getNode()))
+        iterator(typename LinkedList::const_iterator&& it) noexcept
+            : m_currentNode(const_cast<LinkedListNode<T>*>(it.getNode())), m_list(it.getList())
         {
         }
 
@@ -155,9 +191,10 @@ public:
         /// \return A reference to the iterator after the assignment.
         /// \post The iterator is assigned with the same current node as the constant iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        iterator& operator=(typename LinkedList<T>::const_iterator&& it) noexcept
+        iterator& operator=(typename LinkedList::const_iterator&& it) noexcept
         {
             m_currentNode = const_cast<LinkedListNode<T>*>(it.getNode());
+            m_list = it.getList();
             return *this;
         }
 
@@ -196,20 +233,31 @@ public:
             return m_currentNode;
         }
 
+        /// Get the linked list that the iterator traverses.
+        /// \return A pointer to the linked list, or nullptr for a default constructed iterator.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const LinkedList* getList() const noexcept
+        {
+            return m_list;
+        }
+
     private:
         /// Pointer to the current node where the iterator is pointing.
         /// \note The iterator should always point to a valid node in the linked list,
         /// 	or it should be nullptr if it has reached the end of the list.
-        LinkedListNode<T>* m_currentNode;
+        LinkedListNode<T>* m_currentNode = nullptr;
+
+        /// The linked list that is traversed, the end iterator steps back to its last element.
+        const LinkedList* m_list = nullptr;
     };
 
-    /// A forward constant iterator for traversing elements in the linked list.
+    /// A bidirectional constant iterator for traversing elements in the linked list.
     class const_iterator : public std::iterator<
-                               std::forward_iterator_tag,
-                               const LinkedListNode<T>,
+                               std::bidirectional_iterator_tag,
+                               T,
                                std::ptrdiff_t,
-                               const LinkedListNode<T>*,
-                               const LinkedListNode<T>&>
+                               const T*,
+                               const T&>
     {
     public:
         /// Default constructor.
@@ -219,10 +267,11 @@ public:
 
         /// Constructor.
         /// \param node Pointer to the LinkedListNode to initialize constant iterator with.
+        /// \param list The linked list that is traversed, used for stepping back from the end.
         /// \post The iterator is constructed with the given LinkedListNode as the current node.
         /// \exception noexcept No exceptions are thrown by this operation.
-        explicit const_iterator(LinkedListNode<T>* node) noexcept
-            : m_currentNode(node)
+        const_iterator(LinkedListNode<T>* node, const LinkedList* list) noexcept
+            : m_currentNode(node), m_list(list)
         {
         }
 
@@ -265,6 +314,29 @@ public:
             return temp;
         }
 
+        /// Pre-decrement operator for the constant iterator.
+        /// \return A reference to the constant iterator after the decrement.
+        /// \pre The constant iterator is not the first one of the traversal.
+        /// \post Moves the constant iterator to the previous node in the linked list, or from the end to the last node.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const_iterator& operator--() noexcept
+        {
+            m_currentNode = m_currentNode ? m_currentNode->m_inverse : m_list->m_tail;
+            return *this;
+        }
+
+        /// Post-decrement operator for the constant iterator.
+        /// \return A constant iterator pointing to the position before the decrement.
+        /// \pre The constant iterator is not the first one of the traversal.
+        /// \post Moves the constant iterator to the previous node in the linked list, or from the end to the last node.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const_iterator operator--(int) noexcept
+        {
+            const_iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
         /// Equality comparison operator for the iterator.
         /// \param other The constant iterator to compare with.
         /// \return True if both of the constant iterators point to the same node, otherwise false.
@@ -289,8 +361,8 @@ public:
         /// \param it The `iterator` to copy construct from.
         /// \post The constant iterator is constructed with the same current node as the `iterator`.
         /// \exception noexcept No exceptions are thrown by this operation.
-        const_iterator(const typename LinkedList<T>::iterator& it) noexcept
-            : m_currentNode(it.getNode())
+        const_iterator(const typename LinkedList::iterator& it) noexcept
+            : m_currentNode(it.getNode()), m_list(it.getList())
         {
         }
 
@@ -299,9 +371,10 @@ public:
         /// \return A reference to the constant iterator after the assignment.
         /// \post The constant iterator is assigned with the same current node as the `iterator`.
         /// \exception noexcept No exceptions are thrown by this operation.
-        const_iterator& operator=(const typename LinkedList<T>::iterator& it) noexcept
+        const_iterator& operator=(const typename LinkedList::iterator& it) noexcept
         {
             m_currentNode = it.getNode();
+            m_list = it.getList();
             return *this;
         }
 
@@ -310,8 +383,8 @@ public:
         /// \post The const_iterator is constructed, taking ownership of the internal
         /// 	pointer from the non-const iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        const_iterator(typename LinkedList<T>::iterator&& it) noexcept
-            : m_currentNode(it.getNode())
+        const_iterator(typename LinkedList::iterator&& it) noexcept
+            : m_currentNode(it.getNode()), m_list(it.getList())
         {
         }
 
@@ -320,9 +393,10 @@ public:
         /// \return A reference to the constant iterator after the assignment.
         /// \post The const_iterator is assigned the value of the non-const iterator, taking ownership of the internal pointer.
         /// \exception noexcept No exceptions are thrown by this operation.
-        const_iterator& operator=(typename LinkedList<T>::iterator&& it) noexcept
+        const_iterator& operator=(typename LinkedList::iterator&& it) noexcept
         {
             m_currentNode = it.getNode();
+            m_list = it.getList();
             return *this;
         }
 
@@ -361,20 +435,31 @@ public:
             return m_currentNode;
         }
 
+        /// Get the linked list that the iterator traverses.
+        /// \return A pointer to the linked list, or nullptr for a default constructed iterator.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const LinkedList* getList() const noexcept
+        {
+            return m_list;
+        }
+
     private:
         /// Pointer to the current node where the iterator is pointing.
         /// \note The iterator should always point to a valid node in the linked list,
         /// 	or it should be nullptr if it has reached the end of the list.
-        LinkedListNode<T>* m_currentNode;
+        LinkedListNode<T>* m_currentNode = nullptr;
+
+        /// The linked list that is traversed, the end iterator steps back to its last element.
+        const LinkedList* m_list = nullptr;
     };
 
-    /// A forward reverse iterator for traversing items backwards in the linked list.
+    /// A bidirectional reverse iterator for traversing items backwards in the linked list.
     class reverse_iterator : public std::iterator<
-                                 std::forward_iterator_tag,
-                                 const LinkedListNode<T>,
+                                 std::bidirectional_iterator_tag,
+                                 T,
                                  std::ptrdiff_t,
-                                 const LinkedListNode<T>*,
-                                 const LinkedListNode<T>&>
+                                 T*,
+                                 T&>
     {
     public:
         /// Default constructor.
@@ -385,10 +470,11 @@ public:
 
         /// Constructor.
         /// \param node Pointer to the `LinkedListNode` to initialize reverse iterator with.
+        /// \param list The linked list that is traversed, used for stepping back from the end.
         /// \post The reverse iterator is constructed with the given `LinkedListNode` as the current node.
         /// \exception noexcept No exceptions are thrown by this operation.
-        explicit reverse_iterator(LinkedListNode<T>* node) noexcept
-            : m_currentNode(node)
+        reverse_iterator(LinkedListNode<T>* node, const LinkedList* list) noexcept
+            : m_currentNode(node), m_list(list)
         {
         }
 
@@ -431,6 +517,29 @@ public:
             return temp;
         }
 
+        /// Pre-decrement operator for the reverse iterator.
+        /// \return A reference to the reverse iterator after the decrement.
+        /// \pre The reverse iterator is not the first one of the traversal.
+        /// \post Moves the reverse iterator to the next node in the linked list, or from the end to the first node.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        reverse_iterator& operator--() noexcept
+        {
+            m_currentNode = m_currentNode ? m_currentNode->m_next : m_list->m_head;
+            return *this;
+        }
+
+        /// Post-decrement operator for the reverse iterator.
+        /// \return A reverse iterator pointing to the position before the decrement.
+        /// \pre The reverse iterator is not the first one of the traversal.
+        /// \post Moves the reverse iterator to the next node in the linked list, or from the end to the first node.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        reverse_iterator operator--(int) noexcept
+        {
+            reverse_iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
         /// Equality comparison operator for the iterator.
         /// \param other The reverse iterator to compared with.
         /// \return True of both reverse iterators point to the same node, otherwise false.
@@ -455,8 +564,8 @@ public:
         /// \param it The constant reverse iterator to copy construct from.
         /// \post The reverse iterator is constructed with the same current node as the constant reverse iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        reverse_iterator(const typename LinkedList<T>::const_reverse_iterator& it) noexcept
-            : m_currentNode(const_cast<LinkedListNode<T>*>(it.getNode()))
+        reverse_iterator(const typename LinkedList::const_reverse_iterator& it) noexcept
+            : m_currentNode(const_cast<LinkedListNode<T>*>(it.getNode())), m_list(it.getList())
         {
         }
 
@@ -465,9 +574,10 @@ public:
         /// \return A reference to the reverse iterator after the assignment.
         /// \post The reverse iterator is assigned with the same current node as the constant reverse iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        reverse_iterator& operator=(const typename LinkedList<T>::const_reverse_iterator& it) noexcept
+        reverse_iterator& operator=(const typename LinkedList::const_reverse_iterator& it) noexcept
         {
             m_currentNode = const_cast<LinkedListNode<T>*>(it.getNode());
+            m_list = it.getList();
             return *this;
         }
 
@@ -475,8 +585,8 @@ public:
         /// \param it The constant reverse iterator to move construct from.
         /// \post The reverse iterator is constructed with the same current node as the constant reverse iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        reverse_iterator(typename LinkedList<T>::const_reverse_iterator&& it) noexcept
-            : m_currentNode(const_cast<LinkedListNode<T>*>(it.getNode()))
+        reverse_iterator(typename LinkedList::const_reverse_iterator&& it) noexcept
+            : m_currentNode(const_cast<LinkedListNode<T>*>(it.getNode())), m_list(it.getList())
         {
         }
 
@@ -485,9 +595,10 @@ public:
         /// \return A reference to the reverse iterator after the assignment.
         /// \post The reverse iterator is assigned with the same current node as the constant reverse iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        reverse_iterator& operator=(typename LinkedList<T>::const_reverse_iterator&& it) noexcept
+        reverse_iterator& operator=(typename LinkedList::const_reverse_iterator&& it) noexcept
         {
             m_currentNode = const_cast<LinkedListNode<T>*>(it.getNode());
+            m_list = it.getList();
             return *this;
         }
 
@@ -526,20 +637,31 @@ public:
             return m_currentNode;
         }
 
+        /// Get the linked list that the iterator traverses.
+        /// \return A pointer to the linked list, or nullptr for a default constructed iterator.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const LinkedList* getList() const noexcept
+        {
+            return m_list;
+        }
+
     private:
         /// Pointer to the current node where the reverse iterator is pointing.
         /// \note The reverse iterator should always point to a valid node in the linked list,
         /// 	or it should be nullptr if it has reached the end of the list.
-        LinkedListNode<T>* m_currentNode;
+        LinkedListNode<T>* m_currentNode = nullptr;
+
+        /// The linked list that is traversed, the end iterator steps back to its last element.
+        const LinkedList* m_list = nullptr;
     };
 
-    /// A forward constant reverse iterator for traversing items backwards in the linked list.
+    /// A bidirectional constant reverse iterator for traversing items backwards in the linked list.
     class const_reverse_iterator : public std::iterator<
-                                       std::forward_iterator_tag,
-                                       const LinkedListNode<T>,
+                                       std::bidirectional_iterator_tag,
+                                       T,
                                        std::ptrdiff_t,
-                                       const LinkedListNode<T>*,
-                                       const LinkedListNode<T>&>
+                                       const T*,
+                                       const T&>
     {
     public:
         /// Default constructor.
@@ -550,10 +672,11 @@ public:
 
         /// Constructor.
         /// \param node Pointer to the `LinkedListNode` to initialize constant reverse iterator with.
+        /// \param list The linked list that is traversed, used for stepping back from the end.
         /// \post The constant reverse iterator is constructed with the given `LinkedListNode` as the current node.
         /// \exception noexcept No exceptions are thrown by this operation.
-        explicit const_reverse_iterator(LinkedListNode<T>* node) noexcept
-            : m_currentNode(node)
+        const_reverse_iterator(LinkedListNode<T>* node, const LinkedList* list) noexcept
+            : m_currentNode(node), m_list(list)
         {
         }
 
@@ -596,6 +719,29 @@ public:
             return temp;
         }
 
+        /// Pre-decrement operator for the constant reverse iterator.
+        /// \return A reference to the constant reverse iterator after the decrement.
+        /// \pre The constant reverse iterator is not the first one of the traversal.
+        /// \post Moves the constant reverse iterator to the next node in the linked list, or from the end to the first node.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const_reverse_iterator& operator--() noexcept
+        {
+            m_currentNode = m_currentNode ? m_currentNode->m_next : m_list->m_head;
+            return *this;
+        }
+
+        /// Post-decrement operator for the constant reverse iterator.
+        /// \return A constant reverse iterator pointing to the position before the decrement.
+        /// \pre The constant reverse iterator is not the first one of the traversal.
+        /// \post Moves the constant reverse iterator to the next node in the linked list, or from the end to the first node.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const_reverse_iterator operator--(int) noexcept
+        {
+            const_reverse_iterator temp = *this;
+            --*this;
+            return temp;
+        }
+
         /// Equality comparison operator for the constant reverse iterator.
         /// \param other The constant reverse iterator to compare with.
         /// \return True if both of the constant reverse iterators point to the same node, otherwise false.
@@ -619,8 +765,8 @@ public:
         /// \param it The reverse iterator to copy construct from.
         /// \post The constant reverse iterator is constructed with the same current node as the non-const reverse iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        const_reverse_iterator(const typename LinkedList<T>::reverse_iterator& it) noexcept
-            : m_currentNode(it.getNode())
+        const_reverse_iterator(const typename LinkedList::reverse_iterator& it) noexcept
+            : m_currentNode(it.getNode()), m_list(it.getList())
         {
         }
 
@@ -629,9 +775,10 @@ public:
         /// \return A reference to the constant reverse iterator after the assignment.
         /// \post The constant reverse iterator is assigned with the same current node as the non-const reverse iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        const_reverse_iterator& operator=(const typename LinkedList<T>::reverse_iterator& it) noexcept
+        const_reverse_iterator& operator=(const typename LinkedList::reverse_iterator& it) noexcept
         {
             m_currentNode = it.getNode();
+            m_list = it.getList();
             return *this;
         }
 
@@ -640,8 +787,8 @@ public:
         /// \post The constant reverse iterator is constructed, taking ownership of the internal
         /// 	pointer from the non-const reverse iterator.
         /// \exception noexcept No exceptions are thrown by this operation.
-        const_reverse_iterator(typename LinkedList<T>::reverse_iterator&& it) noexcept
-            : m_currentNode(it.getNode())
+        const_reverse_iterator(typename LinkedList::reverse_iterator&& it) noexcept
+            : m_currentNode(it.getNode()), m_list(it.getList())
         {
         }
 
@@ -651,9 +798,10 @@ public:
         /// \post The constant reverse iterator is assigned with the value of the reverse iterator,
         /// 	taking ownership of the internal pointer.
         /// \exception noexcept No exceptions are thrown by this operation.
-        const_reverse_iterator& operator=(typename LinkedList<T>::reverse_iterator&& it) noexcept
+        const_reverse_iterator& operator=(typename LinkedList::reverse_iterator&& it) noexcept
         {
             m_currentNode = it.getNode();
+            m_list = it.getList();
             return *this;
         }
 
@@ -692,17 +840,37 @@ public:
             return m_currentNode;
         }
 
+        /// Get the linked list that the iterator traverses.
+        /// \return A pointer to the linked list, or nullptr for a default constructed iterator.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        const LinkedList* getList() const noexcept
+        {
+            return m_list;
+        }
+
     private:
         /// Pointer to the node where the constant reverse iterator is pointing.
         /// \note The constant reverse iterator should always point to a valid node in the linked list,
         /// 	or it should be nullptr if it has reached the end of the list.
-        LinkedListNode<T>* m_currentNode;
+        LinkedListNode<T>* m_currentNode = nullptr;
+
+        /// The linked list that is traversed, the end iterator steps back to its last element.
+        const LinkedList* m_list = nullptr;
     };
 
     /// Default constructor.
     /// \post Constructs a new `LinkedList` object with no elements.
+    /// \exception noexcept No exceptions are thrown by this operation, unless the default constructor of the allocator throws.
+    LinkedList() noexcept(std::is_nothrow_default_constructible<Allocator>::value)
+    {
+    }
+
+    /// Allocator constructor.
+    /// \param allocator The allocator of the nodes.
+    /// \post Constructs a new `LinkedList` object with no elements, whose nodes are allocated by `allocator`.
     /// \exception noexcept No exceptions are thrown by this operation.
-    LinkedList() noexcept
+    explicit LinkedList(const Allocator& allocator) noexcept
+        : m_allocator(allocator)
     {
     }
 
@@ -732,7 +900,7 @@ public:
     ///       The other LinkedList will be left in a valid but unspecified state.
     /// \exception noexcept No exceptions are thrown by this operation.
     LinkedList(LinkedList&& other) noexcept
-        : m_head(other.m_head), m_tail(other.m_tail), m_count(other.m_count)
+        : m_head(other.m_head), m_tail(other.m_tail), m_count(other.m_count), m_allocator(other.m_allocator)
     {
         other.m_head = nullptr;
         other.m_tail = nullptr;
@@ -744,43 +912,72 @@ public:
     /// \return A reference to the LinkedList after the move assignment.
     /// \post Moves the content from the other LinkedList to this LinkedList.
     ///       The other LinkedList will be left in a valid but unspecified state.
-    /// \exception noexcept No exceptions are thrown by this operation.
-    LinkedList& operator=(LinkedList&& other) noexcept
+    /// \exception noexcept No exceptions are thrown when the allocator propagates on move assignment. Otherwise,
+    ///            if the allocators compare unequal, the elements are moved into nodes of this allocator one by one
+    ///            and any exception of the allocation or the move constructor is passed on, leaving this LinkedList unchanged.
+    LinkedList& operator=(LinkedList&& other) noexcept(AllocatorTraits::propagate_on_container_move_assignment::value)
     {
         if (this != &other)
         {
-            m_head = other.m_head;
-            m_tail = other.m_tail;
-            m_count = other.m_count;
-
-            other.m_head = nullptr;
-            other.m_tail = nullptr;
-            other.m_count = 0;
+            moveAssign(other, typename AllocatorTraits::propagate_on_container_move_assignment());
         }
         return *this;
     }
 
     /// Copy constructor.
     /// \param other The LinkedList to be copied from.
-    /// \post Constructs a new LinkedList by copying the content from the other LinkedList.
-    /// \exception noexcept No exceptions are thrown by this operation.
-    LinkedList(const LinkedList<T>& other) noexcept
-        : m_head(other.m_head), m_tail(other.m_tail), m_count(other.m_count)
+    /// \post Constructs a new LinkedList with copies of the elements of the other LinkedList in the same order.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the elements.
+    ///            The elements copied so far are destroyed before the exception is passed on.
+    LinkedList(const LinkedList& other)
+        : LinkedList(other, AllocatorTraits::select_on_container_copy_construction(other.m_allocator))
     {
     }
 
+    /// Copy constructor with an allocator.
+    /// \param other The LinkedList to be copied from.
+    /// \param allocator The allocator of the nodes of the new LinkedList.
+    /// \post Constructs a new LinkedList with copies of the elements of the other LinkedList in the same order.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the elements.
+    ///            The elements copied so far are destroyed before the exception is passed on.
+    LinkedList(const LinkedList& other, const Allocator& allocator)
+        : m_allocator(allocator)
+    {
+        try
+        {
+            for (auto* node = other.m_head; node; node = node->m_next)
+            {
+                emplace(node->m_data);
+            }
+        }
+        catch (...)
+        {
+            clear();
+            throw;
+        }
+    }
+
     /// Copy assignment operator.
     /// \param other The LinkedList to be assigned from.
-    /// \return A reference to the LinkedList after the attempted copy assignment.
-    /// \post Copies the content from the other LinkedList to this LinkedList.
-    /// \exception noexcept No exceptions are thrown by this operation.
-    LinkedList& operator=(const LinkedList<T>& other) noexcept
+    /// \return A reference to the LinkedList after the copy assignment.
+    /// \post The elements of this LinkedList are replaced with copies of the elements of the other LinkedList.
+    ///       The allocator of `other` replaces the allocator of this LinkedList only if it propagates on copy assignment.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the elements.
+    ///            This LinkedList is left unchanged.
+    LinkedList& operator=(const LinkedList& other)
     {
         if (this != &other)
         {
-            m_head = other.m_head;
-            m_tail = other.m_tail;
-            m_count = other.m_count;
+            const bool propagate = AllocatorTraits::propagate_on_container_copy_assignment::value;
+            LinkedList copy(other, propagate ? other.m_allocator : m_allocator);
+
+            // The old nodes leave with the allocator they were allocated with.
+            swapNodes(copy);
+            if (propagate)
+            {
+                using std::swap;
+                swap(m_allocator, copy.m_allocator);
+            }
         }
         return *this;
     }
@@ -791,7 +988,7 @@ public:
     /// \exception noexcept No exceptions are thrown by this operation.
     iterator begin() noexcept
     {
-        return iterator(m_head);
+        return iterator(m_head, this);
     }
 
     /// Get an iterator to the end of the linked list.
@@ -800,7 +997,25 @@ public:
     /// \exception noexcept No exceptions are thrown by this operation.
     iterator end() noexcept
     {
-        return iterator(nullptr);
+        return iterator(nullptr, this);
+    }
+
+    /// Get a const iterator to the beginning of the linked list in const context.
+    /// \return A const iterator pointing to the first element in the linked list.
+    /// \note If the linked list is empty, the iterator will be equal to the end iterator.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(m_head, this);
+    }
+
+    /// Get a const iterator to the end of the linked list in const context.
+    /// \return A const iterator pointing to the position past the last element in the linked list.
+    /// \note This constant iterator acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator end() const noexcept
+    {
+        return const_iterator(nullptr, this);
     }
 
     /// Get a const iterator to the beginning of the linked list.
@@ -809,7 +1024,7 @@ public:
     /// \exception noexcept No exceptions are thrown by this operation.
     const_iterator cbegin() const noexcept
     {
-        return const_iterator(m_head);
+        return const_iterator(m_head, this);
     }
 
     /// Get a const iterator to the end of the linked list.
@@ -818,56 +1033,81 @@ public:
     /// \exception noexcept No exceptions are thrown by this operation.
     const_iterator cend() const noexcept
     {
-        return const_iterator(nullptr);
+        return const_iterator(nullptr, this);
     }
 
-    /// Get a reverse iterator to the beginning of the linked list.
-    /// \return A reverse iterator pointing past the first element in the linked list.
-    /// \note This reverse iterator acts as a sentinel and should not be dereferenced.
+    /// Get a reverse iterator to the beginning of the reversed linked list.
+    /// \return A reverse iterator pointing to the last element in the linked list.
+    /// \note If the linked list is empty, this reverse iterator will be equal to the rend iterator.
     /// \exception noexcept No exceptions are thrown by this operation.
     reverse_iterator rbegin() noexcept
     {
-        return reverse_iterator(nullptr);
+        return reverse_iterator(m_tail, this);
     }
 
-    /// Get a reverse iterator to the beginning of the linked list.
-    /// \return A reverse iterator pointing to the last element in the linked list.
-    /// \note If linked list is empty, this reverse iterator will be equal to the crbegin iterator.
+    /// Get a reverse iterator to the end of the reversed linked list.
+    /// \return A reverse iterator pointing past the first element in the linked list.
+    /// \note This reverse iterator acts as a sentinel and should not be dereferenced.
     /// \exception noexcept No exceptions are thrown by this operation.
     reverse_iterator rend() noexcept
     {
-        return reverse_iterator(m_tail);
+        return reverse_iterator(nullptr, this);
     }
 
-    /// Get a constant reverse iterator to the beginning of the linked list.
+    /// Get a constant reverse iterator to the beginning of the reversed linked list in const context.
+    /// \return A constant reverse iterator pointing to the last element in the linked list.
+    /// \note If the linked list is empty, this constant reverse iterator will be equal to the rend iterator.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(m_tail, this);
+    }
+
+    /// Get a constant reverse iterator to the end of the reversed linked list in const context.
     /// \return A constant reverse iterator pointing past the first element in the linked list.
-    /// \note If constant reverse iterator acts as a sentinel and should not be dereferenced.
+    /// \note This constant reverse iterator acts as a sentinel and should not be dereferenced.
     /// \exception noexcept No exceptions are thrown by this operation.
-    const_reverse_iterator crbegin() const noexcept
+    const_reverse_iterator rend() const noexcept
     {
-        return const_reverse_iterator(nullptr);
+        return const_reverse_iterator(nullptr, this);
     }
 
-    /// Get a constant reverse iterator to end of the linked list.
+    /// Get a constant reverse iterator to the beginning of the reversed linked list.
     /// \return A constant reverse iterator pointing to the last element in the linked list.
-    /// \note If linked list is empty, this constant reverse iterator will be equal to the crend iterator.
+    /// \note If the linked list is empty, this constant reverse iterator will be equal to the crend iterator.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(m_tail, this);
+    }
+
+    /// Get a constant reverse iterator to the end of the reversed linked list.
+    /// \return A constant reverse iterator pointing past the first element in the linked list.
+    /// \note This constant reverse iterator acts as a sentinel and should not be dereferenced.
     /// \exception noexcept No exceptions are thrown by this operation.
     const_reverse_iterator crend() const noexcept
     {
-        return const_reverse_iterator(m_tail);
+        return const_reverse_iterator(nullptr, this);
     }
 
     /// Clear the elements in the LinkedList and deallocate memory.
-    /// \post Removes all elements from the LinkedList, and deallocates the memory used by each element.
+    /// \post Destroys all elements of the LinkedList, and deallocates the memory used by each element.
     /// \exception noexcept No exceptions are thrown by this operation.
+    /// \note With an allocator that can release its blocks at once, such as a PoolAllocator that holds no other nodes,
+    ///       the memory is released in O(chunks) instead of node by node, see HasRelease.
     void clear() noexcept
     {
-        while (m_head)
+        if (!releaseNodes(HasRelease<Allocator>()))
         {
-            auto* next = m_head->m_next;
-            m_allocator.deallocate(m_head, 1);
-            m_head = next;
+            while (m_head)
+            {
+                auto* next = m_head->m_next;
+                destroyNode(m_head);
+                m_head = next;
+            }
         }
+        m_head = nullptr;
+        m_tail = nullptr;
         m_count = 0;
     }
 
@@ -876,12 +1116,36 @@ public:
     /// \return An iterator that points to the newly inserted element.
     /// \pre The value_type of the linked list must be copy constructible.
     /// \post The element with the specified value is inserted at the end of the linked list.
-    /// \exception May throw std::bad_alloc if memory allocation fails during the operation.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the element.
+    ///            The linked list is left unchanged.
     /// \note If the value_type of the linked list is not copy constructible, this function will not compile.
     iterator insert(const T& value)
     {
-        auto* newNode = m_allocator.allocate(1);
-        m_allocator.construct(newNode, value);
+        return emplace(value);
+    }
+
+    /// Insert a new element at the end of the linked list by moving the value.
+    /// \param value The value to be moved into the linked list.
+    /// \return An iterator that points to the newly inserted element.
+    /// \post The element holding the moved value is inserted at the end of the linked list.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the move constructor of the element.
+    ///            The linked list is left unchanged.
+    iterator insert(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /// Construct a new element in place at the end of the linked list.
+    /// \param args The arguments forwarded to the constructor of the element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return An iterator that points to the newly inserted element.
+    /// \post The element constructed from `args` is inserted at the end of the linked list.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the constructor of the element.
+    ///            The linked list is left unchanged.
+    template <typename... Args>
+    iterator emplace(Args&&... args)
+    {
+        auto* newNode = createNode(std::forward<Args>(args)...);
 
         // List is empty.
         if (!m_head)
@@ -900,7 +1164,7 @@ public:
         }
         m_count++;
 
-        return iterator(m_tail);
+        return iterator(m_tail, this);
     }
 
     /// Insert a new element with the given value at the specified position in the linked list.
@@ -910,97 +1174,52 @@ public:
     /// \pre The value_type of the linked list must be copy constructible.
     /// \pre The iterator `pos` must be a valid iterator within the linked list.
     /// \post The element with the specified value is inserted at the position indicated by `pos`.
-    /// \exception May throw std::bad_alloc if memory allocation fails during the operation.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the element.
+    ///            The linked list is left unchanged.
     /// \note If the value_type of the linked list is not copy constructible, this function will not compile.
     iterator insert(iterator pos, const T& value)
     {
-        auto* newNode = m_allocator.allocate(1);
-        m_allocator.construct(newNode, value);
-
-        // List is empty.
-        if (!m_head)
-        {
-            m_head = newNode;
-            m_tail = newNode;
-        }
-        // Inserting to beginning.
-        else if (pos == begin() && begin() != end())
-        {
-            newNode->m_next = m_head;
-            m_head->m_inverse = newNode;
-            m_head = newNode;
-        }
-        // Inserting to end.
-        else if (pos == end())
-        {
-            newNode->m_inverse = m_tail;
-            m_tail->m_next = newNode;
-            m_tail = newNode;
-        }
-        // Inserting to any other position.
-        else
-        {
-            auto* ogNode = pos.getNode();
-            ogNode->m_inverse->m_next = newNode;
-            ogNode->m_inverse = newNode;
-
-            newNode->m_next = ogNode;
-            newNode->m_inverse = ogNode->m_inverse;
-        }
+        return linkBefore(pos, createNode(value));
+    }
 
-        m_count++;
-        return iterator(newNode);
+    /// Insert a new element at the specified position in the linked list by moving the value.
+    /// \param pos An iterator pointing to the position where the element is inserted.
+    /// \param value The value to be moved into the linked list.
+    /// \return An iterator that points to the newly inserted element.
+    /// \pre The iterator `pos` must be a valid iterator within the linked list.
+    /// \post The element holding the moved value is inserted at the position indicated by `pos`.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the move constructor of the element.
+    ///            The linked list is left unchanged.
+    iterator insert(iterator pos, T&& value)
+    {
+        return linkBefore(pos, createNode(std::move(value)));
     }
 
-    /// Remove all occurrences of the specified value from the linked list.
-    /// \param value The value of the elements to be removed.
-    /// \return An iterator that points to the element following the last removed element, or the end() iterator if no element was removed.
+    /// Remove the first occurrence of the specified value from the linked list.
+    /// \param value The value of the element to be removed.
+    /// \return An iterator that points to the element following the removed element, or the end() iterator if no element was removed.
     /// \pre The value_type of the linked list must support equality comparison.
-    /// \post All elements with the specified value are removed from the linked list.
-    /// \exception May throw an exception if memory deallocation fails (depends on the allocator).
+    /// \post The first element with the specified value is destroyed and removed from the linked list.
+    /// \exception Any exception thrown by the comparison of the elements.
     iterator erase(const T& value)
     {
         auto* currentNode = m_head;
-        LinkedListNode<T>* previousNode = nullptr;
 
         while (currentNode && currentNode->m_data != value)
         {
-            previousNode = currentNode;
             currentNode = currentNode->m_next;
         }
 
-        if (currentNode)
+        if (!currentNode)
         {
-            // Target Node is the head Node.
-            if (!previousNode)
-            {
-                m_head = currentNode->m_next;
-                currentNode->m_next->m_inverse = nullptr;
-            }
-
-            // Target Node is the tail Node.
-            else if (!currentNode->m_next)
-            {
-                m_tail = previousNode;
-                previousNode->m_next = nullptr;
-            }
-
-            // Target Node is normal Node.
-            else
-            {
-                previousNode->m_next = currentNode->m_next;
-                currentNode->m_next->m_inverse = previousNode;
-            }
-
-            LinkedListNode<T>* returnNode = currentNode->m_next;
-            m_allocator.deallocate(currentNode, 1);
-            m_count--;
-            return iterator(returnNode);
-        }
-        else
-        {
-            return iterator(m_tail);
+            return end();
         }
+
+        auto* nextNode = currentNode->m_next;
+        unlink(currentNode);
+        destroyNode(currentNode);
+        m_count--;
+        return iterator(nextNode, this);
     }
 
     /// Remove the element at the specified position in the linked list.
@@ -1008,156 +1227,206 @@ public:
     /// \return An iterator that points to the element following the removed element, or the end() iterator if the last element was removed.
     /// \pre The provided iterator must be valid and dereferenceable.
     /// \pre The linked list must not be empty.
-    /// \post The element at the position specified by the iterator is removed from the linked list.
+    /// \post The element at the position specified by the iterator is destroyed and removed from the linked list.
     /// \post The iterator following the removed element is returned.
-    /// \exception May throw an exception if memory deallocation fails (depends on the allocator).
-    iterator erase(iterator pos)
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator erase(iterator pos) noexcept
     {
         auto* removable = pos.getNode();
-        auto* nextNode = removable->m_next;
 
         if (removable == nullptr)
         {
-            return iterator(m_tail);
-        }
-        else if (removable == m_head)
-        {
-            m_head = removable->m_next;
-
-            if (m_head)
-            {
-                m_head->m_inverse = nullptr;
-            }
-            else
-            {
-                m_tail = nullptr;
-            }
-        }
-        else if (removable == m_tail)
-        {
-            m_tail = removable->m_inverse;
-            m_tail->m_next = nullptr;
-        }
-        else
-        {
-            LinkedListNode<T>* prevNode = removable->m_inverse;
-            prevNode->m_next = nextNode;
-            nextNode->m_inverse = prevNode;
+            return end();
         }
 
+        auto* nextNode = removable->m_next;
+        unlink(removable);
+        destroyNode(removable);
         m_count--;
-        m_allocator.deallocate(removable, 1);
-        return iterator(nextNode);
+        return iterator(nextNode, this);
     }
 
-    /// Remove the elements in the range [first, last] from the linked list.
+    /// Remove the elements in the range [first, last) from the linked list.
     /// \param first An iterator pointing to the first element of the range to be removed.
     /// \param last An iterator pointing to the element just beyond the last element of the range to be removed.
-    /// \return An iterator that points to the element following the last removed element, or the end() iterator if the last element was removed.
-    /// \pre The provided iterators must be valid and dereferenceable.
-    /// \pre The range [first, last] must be a valid range within the linked list.
-    /// \post The elements in the range [first, last] are removed from the linked list.
-    /// \post The iterator following the last removed element is returned.
-    /// \exception May throw an exception if the deallocation of memory fails.
-    iterator erase(iterator first, iterator last)
+    /// \return An iterator equal to `last`.
+    /// \pre The range [first, last) must be a valid range within the linked list.
+    /// \post The elements in the range [first, last) are destroyed and removed from the linked list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator erase(iterator first, iterator last) noexcept
     {
-        // Get Node where the first iterator is pointing.
-        auto* firstNode = first.getNode();
+        auto* currentNode = first.getNode();
+        auto* lastNode = last.getNode();
 
-        // Get Node where the last iterator is pointing.
-        LinkedListNode<T>* lastNode;
-        if (last == end())
-        {
-            lastNode = m_tail;
-        }
-        else
+        while (currentNode != lastNode)
         {
-            lastNode = last.getNode();
+            auto* next = currentNode->m_next;
+            unlink(currentNode);
+            destroyNode(currentNode);
+            m_count--;
+            currentNode = next;
         }
 
-        if (!firstNode || !lastNode || firstNode == lastNode)
-        {
-            return iterator(nullptr);
-        }
+        return last;
+    }
 
-        // Get the Nodes before and after range.
-        LinkedListNode<T>* prevNode = nullptr;
-        LinkedListNode<T>* nextNode = nullptr;
+    /// Swap the contents of this linked list with another linked list.
+    /// \param other The other linked list to swap with.
+    /// \pre The allocators of the two linked lists compare equal, unless the allocator propagates on swap.
+    /// \post The contents of this linked list are exchanged with the contents of the other linked list.
+    ///       The allocators are exchanged only if they propagate on swap.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swap(LinkedList& other) noexcept
+    {
+        swapNodes(other);
 
-        if (first != begin())
+        if (AllocatorTraits::propagate_on_container_swap::value)
         {
-            prevNode = firstNode->m_inverse;
+            using std::swap;
+            swap(m_allocator, other.m_allocator);
         }
+    }
 
-        if (last != end() || lastNode != m_tail)
+    /// Move all elements of another linked list in front of a position by relinking the nodes.
+    /// \param pos A constant iterator to the position the elements are moved in front of, cend() appends them.
+    /// \param other The linked list whose elements are moved, left empty.
+    /// \pre The allocators of the two linked lists compare equal, the nodes are deallocated by this linked list.
+    /// \pre The iterator `pos` must be a valid iterator within this linked list.
+    /// \post The elements of `other` are in this linked list in their original order in front of `pos`.
+    ///       Iterators to the moved elements stay valid and refer to the elements in this linked list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1) No element is copied, moved or allocated.
+    void splice(const_iterator pos, LinkedList& other) noexcept
+    {
+        if (this == &other || !other.m_head)
         {
-            nextNode = lastNode->m_next;
+            return;
         }
 
-        // Reset m_head and m_tail pointers, connect the Nodes after range if possible.
-        if (!prevNode && nextNode)
-        {
-            m_head = nextNode;
-        }
-        else if (prevNode && !nextNode)
-        {
-            m_tail = prevNode;
-        }
-        else if (!prevNode && !nextNode)
-        {
-            m_head = nullptr;
-            m_tail = nullptr;
-        }
-        else
-        {
-            m_head = prevNode;
-            m_tail = nextNode;
-            prevNode->m_next = nextNode;
-            nextNode->m_inverse = prevNode;
-        }
+        auto* nextNode = const_cast<LinkedListNode<T>*>(pos.getNode());
+        auto* prevNode = nextNode ? nextNode->m_inverse : m_tail;
 
-        // Delete the Nodes within the range.
-        LinkedListNode<T>* currentNode = firstNode;
+        other.m_head->m_inverse = prevNode;
+        other.m_tail->m_next = nextNode;
+        (prevNode ? prevNode->m_next : m_head) = other.m_head;
+        (nextNode ? nextNode->m_inverse : m_tail) = other.m_tail;
+        m_count += other.m_count;
 
-        while (currentNode != lastNode)
-        {
-            auto* next = currentNode->m_next;
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
+        other.m_count = 0;
+    }
 
-            m_allocator.deallocate(currentNode, 1);
-            currentNode = next;
-            m_count--;
+    /// Move all elements of an expiring linked list in front of a position by relinking the nodes.
+    /// \param pos A constant iterator to the position the elements are moved in front of, cend() appends them.
+    /// \param other The linked list whose elements are moved, left empty.
+    /// \pre The allocators of the two linked lists compare equal, the nodes are deallocated by this linked list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void splice(const_iterator pos, LinkedList&& other) noexcept
+    {
+        splice(pos, other);
+    }
+
+    /// Move one element of a linked list in front of a position by relinking its node.
+    /// \param pos A constant iterator to the position the element is moved in front of, cend() appends it.
+    /// \param other The linked list that holds the element, may be this linked list.
+    /// \param it A constant iterator to the element that is moved.
+    /// \pre The allocators of the two linked lists compare equal, the node is deallocated by this linked list.
+    /// \pre The iterator `it` must be valid and dereferenceable within `other`.
+    /// \post The element is in this linked list in front of `pos`, iterators to it stay valid.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void splice(const_iterator pos, LinkedList& other, const_iterator it) noexcept
+    {
+        auto* node = const_cast<LinkedListNode<T>*>(it.getNode());
+
+        // The element is already in front of itself.
+        if (node == pos.getNode())
+        {
+            return;
         }
 
-        // Deallocate the last element.
-        m_allocator.deallocate(lastNode, 1);
-        m_count--;
+        other.unlink(node);
+        other.m_count--;
+        linkBefore(iterator(pos), node);
+    }
 
-        return iterator(nextNode);
+    /// Merge another sorted linked list into this sorted linked list by relinking the nodes.
+    /// \param other The sorted linked list whose elements are merged, left empty.
+    /// \pre Both linked lists are sorted in ascending order of operator<.
+    /// \pre The allocators of the two linked lists compare equal, the nodes are deallocated by this linked list.
+    /// \post This linked list holds the elements of both in ascending order, equal elements of this linked list
+    ///       stay in front of the equal elements of `other`. Iterators to the elements stay valid.
+    /// \exception Any exception thrown by the comparison, the elements merged so far are in this linked list.
+    /// \par Time complexity:
+    /// - O(n + m) Where n and m are the amounts of elements in the linked lists, no element is copied, moved or allocated.
+    void merge(LinkedList& other)
+    {
+        merge(other, std::less<T>());
     }
 
-    /// Swap the contents of this linked list with another linked list.
-    /// \param other The other linked list to swap with.
-    /// \post The contents of this linked list are exchanged with the contents of the other linked list.
-    /// \exception noexcept No exceptions are thrown by this operation.
-    void swap(LinkedList& other) noexcept
+    /// Merge another sorted linked list into this sorted linked list by relinking the nodes.
+    /// \param other The sorted linked list whose elements are merged, left empty.
+    /// \pre Both linked lists are sorted in ascending order of operator<.
+    /// \pre The allocators of the two linked lists compare equal, the nodes are deallocated by this linked list.
+    /// \exception Any exception thrown by the comparison, the elements merged so far are in this linked list.
+    void merge(LinkedList&& other)
     {
-        auto tempHead = m_head;
-        auto tempTail = m_tail;
-        auto tempCount = m_count;
+        merge(other, std::less<T>());
+    }
 
-        m_head = other.m_head;
-        m_tail = other.m_tail;
-        m_count = other.m_count;
+    /// Merge another sorted linked list into this sorted linked list by relinking the nodes, ordered by a comparison.
+    /// \param other The sorted linked list whose elements are merged, left empty.
+    /// \param comp The comparison that returns true if the first argument is ordered before the second.
+    /// \tparam Compare The type of the comparison.
+    /// \pre Both linked lists are sorted by `comp`.
+    /// \pre The allocators of the two linked lists compare equal, the nodes are deallocated by this linked list.
+    /// \post This linked list holds the elements of both sorted by `comp`, equal elements of this linked list
+    ///       stay in front of the equal elements of `other`. Iterators to the elements stay valid.
+    /// \exception Any exception thrown by the comparison, the elements merged so far are in this linked list.
+    template <typename Compare>
+    void merge(LinkedList& other, Compare comp)
+    {
+        if (this == &other)
+        {
+            return;
+        }
 
-        other.m_head = tempHead;
-        other.m_tail = tempTail;
-        other.m_count = tempCount;
+        auto* node = m_head;
+        while (other.m_head)
+        {
+            while (node && !comp(other.m_head->m_data, node->m_data))
+            {
+                node = node->m_next;
+            }
+
+            // The rest of the other linked list is ordered after every element of this linked list.
+            if (!node)
+            {
+                splice(cend(), other);
+                return;
+            }
+
+            splice(const_iterator(node, this), other, other.cbegin());
+        }
+    }
+
+    /// Merge another sorted linked list into this sorted linked list by relinking the nodes, ordered by a comparison.
+    /// \param other The sorted linked list whose elements are merged, left empty.
+    /// \param comp The comparison that returns true if the first argument is ordered before the second.
+    /// \tparam Compare The type of the comparison.
+    /// \pre Both linked lists are sorted by `comp`.
+    /// \pre The allocators of the two linked lists compare equal, the nodes are deallocated by this linked list.
+    /// \exception Any exception thrown by the comparison, the elements merged so far are in this linked list.
+    template <typename Compare>
+    void merge(LinkedList&& other, Compare comp)
+    {
+        merge(other, comp);
     }
 
     /// Find the first occurrence of a value in the linked list.
     /// \param value The value to search for.
     /// \return An iterator to the first occurrence of the value in the linked list, or the end() iterator if the value is not found.
-    /// \pre The linked list must not be empty.
     /// \exception noexcept No exceptions are thrown by this operation.
     iterator find(const T& value) noexcept
     {
@@ -1166,10 +1435,9 @@ public:
 
     /// Find the first occurrence of a value in the linked list in a constant context.
     /// \param value The value to search for.
-    /// \return An iterator to the first occurrence of the value in the linked list, or the end() iterator if the value is not found.
-    /// \pre The linked list must not be empty.
+    /// \return A constant iterator to the first occurrence of the value in the linked list, or the cend() iterator if the value is not found.
     /// \exception noexcept No exceptions are thrown by this operation.
-    iterator find(const T& value) const noexcept
+    const_iterator find(const T& value) const noexcept
     {
         return std::find(cbegin(), cend(), value);
     }
@@ -1210,6 +1478,14 @@ public:
         return m_tail->m_data;
     }
 
+    /// Returns a copy of the allocator of the linked list.
+    /// \return The allocator used for the nodes.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    Allocator get_allocator() const noexcept
+    {
+        return m_allocator;
+    }
+
     /// Returns the number of elements in the linked list.
     /// \return The number of elements in the linked list.
     /// \exception noexcept No exceptions are thrown by this operation.
@@ -1227,6 +1503,121 @@ public:
     }
 
 private:
+    /// The allocator traits used for constructing, destroying and deallocating the nodes.
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    /// Exchange the nodes of two linked lists, but not their allocators.
+    /// \param other The other linked list.
+    void swapNodes(LinkedList& other) noexcept
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_tail, other.m_tail);
+        std::swap(m_count, other.m_count);
+    }
+
+    /// Move assignment with an allocator that propagates, the nodes of `other` are taken over together with its allocator.
+    /// \param other The linked list to be moved from, left empty.
+    void moveAssign(LinkedList& other, std::true_type) noexcept
+    {
+        // The nodes are deallocated by the allocator they were allocated with.
+        clear();
+        m_allocator = other.m_allocator;
+        swapNodes(other);
+    }
+
+    /// Move assignment with an allocator that does not propagate.
+    /// The nodes of `other` are taken over if the allocators compare equal, otherwise the elements are moved into new nodes.
+    /// \param other The linked list to be moved from, left empty.
+    void moveAssign(LinkedList& other, std::false_type)
+    {
+        if (m_allocator == other.m_allocator)
+        {
+            clear();
+            swapNodes(other);
+            return;
+        }
+
+        // The nodes of `other` can not be deallocated through this allocator.
+        LinkedList moved(m_allocator);
+        for (auto* node = other.m_head; node; node = node->m_next)
+        {
+            moved.emplace(std::move(node->m_data));
+        }
+        swapNodes(moved);
+        other.clear();
+    }
+
+    /// Allocate a node and construct its element.
+    /// \param args The arguments forwarded to the constructor of the element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return Pointer to the new node that is not linked to the list yet.
+    /// \exception Any exception thrown by the allocation or the constructor of the element, nothing is leaked.
+    template <typename... Args>
+    LinkedListNode<T>* createNode(Args&&... args)
+    {
+        auto* node = AllocatorTraits::allocate(m_allocator, 1);
+
+        try
+        {
+            AllocatorTraits::construct(m_allocator, node, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            AllocatorTraits::deallocate(m_allocator, node, 1);
+            throw;
+        }
+        return node;
+    }
+
+    /// Destroy the element of a node and deallocate the node.
+    /// \param node The node that is no longer linked to the list.
+    void destroyNode(LinkedListNode<T>* node) noexcept
+    {
+        AllocatorTraits::destroy(m_allocator, node);
+        AllocatorTraits::deallocate(m_allocator, node, 1);
+    }
+
+    /// Link a new node in front of the position.
+    /// \param pos The position the node is inserted in front of, end() appends the node.
+    /// \param newNode The node that is not linked to any list yet.
+    /// \return An iterator to the new node.
+    iterator linkBefore(iterator pos, LinkedListNode<T>* newNode) noexcept
+    {
+        auto* nextNode = pos.getNode();
+        auto* prevNode = nextNode ? nextNode->m_inverse : m_tail;
+
+        newNode->m_next = nextNode;
+        newNode->m_inverse = prevNode;
+        (prevNode ? prevNode->m_next : m_head) = newNode;
+        (nextNode ? nextNode->m_inverse : m_tail) = newNode;
+
+        m_count++;
+        return iterator(newNode, this);
+    }
+
+    /// Unlink a node from its neighbours, the head and the tail.
+    /// \param node The node that is linked to this list.
+    void unlink(LinkedListNode<T>* node) noexcept
+    {
+        (node->m_inverse ? node->m_inverse->m_next : m_head) = node->m_next;
+        (node->m_next ? node->m_next->m_inverse : m_tail) = node->m_inverse;
+    }
+
+    /// Release the nodes all at once, not supported by the allocator.
+    /// \return False, the nodes have to be deallocated one by one.
+    static bool releaseNodes(std::false_type) noexcept
+    {
+        return false;
+    }
+
+    /// Release the nodes all at once when they are the only blocks in use in the allocator, see HasRelease.
+    /// \return True if the memory of the nodes was released, false if they have to be deallocated one by one.
+    bool releaseNodes(std::true_type) noexcept
+    {
+        // Skipping the walk is only possible when no node needs its element destroyed.
+        return std::is_trivially_destructible<T>::value && m_allocator.release(m_count);
+    }
+
     /// Pointing always to the first element.
     LinkedListNode<T>* m_head = nullptr;
 
@@ -0,0 +1,421 @@
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+/// PoolArena owns the memory handed out by PoolAllocator and all of its copies and rebinds.
+/// Blocks of the same size are carved out of large chunks, and freed blocks are kept in a free list
+/// for reuse instead of being returned to the heap. The chunks are returned to the heap when the arena is destroyed,
+/// or when a pool is released as a whole.
+/// \note The arena is not thread safe, containers sharing an arena must not be used concurrently.
+class PoolArena
+{
+public:
+    /// A pool of equally sized blocks.
+    class Pool
+    {
+    public:
+        /// Constructor.
+        /// \param blockSize The size of every block in bytes, at least the size of a pointer.
+        /// \post Constructs a pool without chunks.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        explicit Pool(std::size_t blockSize) noexcept
+            : m_blockSize(blockSize)
+        {
+        }
+
+        Pool(const Pool&) = delete;
+        Pool& operator=(const Pool&) = delete;
+
+        /// Destructor.
+        /// \post All chunks are returned to the heap.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        ~Pool() noexcept
+        {
+            freeChunks();
+        }
+
+        /// Get the size of the blocks.
+        /// \return The size of every block in bytes.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        std::size_t blockSize() const noexcept
+        {
+            return m_blockSize;
+        }
+
+        /// Get the amount of blocks that are allocated and not yet deallocated.
+        /// \return The amount of blocks in use.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        std::size_t liveBlocks() const noexcept
+        {
+            return m_live;
+        }
+
+        /// Get the amount of chunks taken from the heap.
+        /// \return The amount of chunks owned by the pool.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        std::size_t chunkCount() const noexcept
+        {
+            return m_chunks.size();
+        }
+
+        /// Allocate a block, reusing a freed block when there is one.
+        /// \return Pointer to an uninitialized block of blockSize() bytes.
+        /// \exception std::bad_alloc if a new chunk can not be allocated.
+        /// \par Time complexity:
+        /// - O(1).
+        void* allocate()
+        {
+            if (m_free)
+            {
+                FreeBlock* block = m_free;
+                m_free = block->m_next;
+                ++m_live;
+                return block;
+            }
+
+            if (m_cursor == m_chunkEnd)
+            {
+                addChunk();
+            }
+
+            void* block = m_cursor;
+            m_cursor += m_blockSize;
+            ++m_live;
+            return block;
+        }
+
+        /// Put a block to the free list.
+        /// \param block Pointer to a block allocated from this pool.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        /// \par Time complexity:
+        /// - O(1).
+        void deallocate(void* block) noexcept
+        {
+            m_free = ::new (block) FreeBlock{m_free};
+            --m_live;
+        }
+
+        /// Return all chunks to the heap at once, if the caller owns every block in use.
+        /// \param owned The amount of blocks the caller has allocated from this pool and not deallocated.
+        /// \return True if the chunks were released, false if other blocks are still in use.
+        /// \post On success the pool holds no memory and the caller must not touch its blocks anymore.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        /// \par Time complexity:
+        /// - O(c) Where c is the amount of chunks.
+        bool release(std::size_t owned) noexcept
+        {
+            if (owned != m_live)
+            {
+                return false;
+            }
+
+            freeChunks();
+            m_chunks.clear();
+            m_free = nullptr;
+            m_cursor = nullptr;
+            m_chunkEnd = nullptr;
+            m_blocksPerChunk = firstChunkBlocks;
+            m_live = 0;
+            return true;
+        }
+
+    private:
+        /// A freed block holds the link to the next freed block.
+        struct FreeBlock
+        {
+            FreeBlock* m_next;
+        };
+
+        /// The amount of blocks in the first chunk, every new chunk doubles it up to maxChunkBlocks.
+        static constexpr std::size_t firstChunkBlocks = 32;
+
+        /// The largest amount of blocks in one chunk.
+        static constexpr std::size_t maxChunkBlocks = 4096;
+
+        /// Take a new chunk from the heap and start carving blocks from it.
+        void addChunk()
+        {
+            const std::size_t bytes = m_blockSize * m_blocksPerChunk;
+            m_chunks.reserve(m_chunks.size() + 1);
+
+            char* chunk = static_cast<char*>(::operator new(bytes));
+            m_chunks.push_back(chunk);
+            m_cursor = chunk;
+            m_chunkEnd = chunk + bytes;
+
+            if (m_blocksPerChunk < maxChunkBlocks)
+            {
+                m_blocksPerChunk *= 2;
+            }
+        }
+
+        /// Return the chunks to the heap.
+        void freeChunks() noexcept
+        {
+            for (char* chunk : m_chunks)
+            {
+                ::operator delete(chunk);
+            }
+        }
+
+        /// The size of every block in bytes.
+        std::size_t m_blockSize;
+
+        /// The amount of blocks in the next chunk.
+        std::size_t m_blocksPerChunk = firstChunkBlocks;
+
+        /// The chunks taken from the heap.
+        std::vector<char*> m_chunks;
+
+        /// The next block that has never been allocated in the newest chunk.
+        char* m_cursor = nullptr;
+
+        /// One past the end of the newest chunk.
+        char* m_chunkEnd = nullptr;
+
+        /// The most recently freed block.
+        FreeBlock* m_free = nullptr;
+
+        /// The amount of blocks in use.
+        std::size_t m_live = 0;
+    };
+
+    /// Get the pool for objects of a size and alignment, creating it if needed.
+    /// \param size The size of the objects in bytes.
+    /// \param alignment The alignment of the objects in bytes.
+    /// \return The pool whose blocks fit the objects, objects of the same rounded size share a pool.
+    /// \exception std::bad_alloc if memory allocation fails.
+    Pool& pool(std::size_t size, std::size_t alignment)
+    {
+        if (Pool* existing = find(size, alignment))
+        {
+            return *existing;
+        }
+
+        m_pools.reserve(m_pools.size() + 1);
+        m_pools.push_back(std::unique_ptr<Pool>(new Pool(blockSize(size, alignment))));
+        return *m_pools.back();
+    }
+
+    /// Get the pool for objects of a size and alignment, if it has been created.
+    /// \param size The size of the objects in bytes.
+    /// \param alignment The alignment of the objects in bytes.
+    /// \return Pointer to the pool whose blocks fit the objects, or nullptr.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    Pool* find(std::size_t size, std::size_t alignment) const noexcept
+    {
+        const std::size_t wanted = blockSize(size, alignment);
+
+        for (const auto& pool : m_pools)
+        {
+            if (pool->blockSize() == wanted)
+            {
+                return pool.get();
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    /// Round the object size up to a block that can also hold the free list link.
+    static std::size_t blockSize(std::size_t size, std::size_t alignment) noexcept
+    {
+        const std::size_t align = alignment > alignof(void*) ? alignment : alignof(void*);
+        const std::size_t minimum = size > sizeof(void*) ? size : sizeof(void*);
+        return (minimum + align - 1) / align * align;
+    }
+
+    /// The pools of every block size used with this arena.
+    std::vector<std::unique_ptr<Pool>> m_pools;
+};
+
+/// PoolAllocator allocates single objects from a PoolArena shared by all of its copies and rebinds.
+/// It is meant for node based containers such as LinkedList, std::list, std::forward_list and std::multiset,
+/// which allocate one node at a time. Requests for more than one object go straight to the heap.
+/// \tparam T The type of the allocated objects.
+template <typename T>
+class PoolAllocator
+{
+public:
+    /// The type of the allocated objects.
+    using value_type = T;
+
+    /// Containers take the arena of the allocator with the contents when they are assigned or swapped.
+    using propagate_on_container_copy_assignment = std::true_type;
+
+    /// Containers take the arena of the allocator with the contents when they are assigned or swapped.
+    using propagate_on_container_move_assignment = std::true_type;
+
+    /// Containers take the arena of the allocator with the contents when they are assigned or swapped.
+    using propagate_on_container_swap = std::true_type;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "PoolAllocator does not support over-aligned types.");
+
+    /// Default constructor.
+    /// \post Constructs an allocator with a new arena of its own.
+    /// \exception std::bad_alloc if memory allocation fails.
+    PoolAllocator()
+        : m_arena(std::make_shared<PoolArena>())
+    {
+    }
+
+    /// Constructor.
+    /// \param arena The arena the memory is taken from, shared with other allocators.
+    /// \post Constructs an allocator that allocates from `arena`.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    explicit PoolAllocator(std::shared_ptr<PoolArena> arena) noexcept
+        : m_arena(std::move(arena))
+    {
+    }
+
+    /// Copy constructor, also used for moves so the source keeps sharing the arena.
+    /// A moved-from allocator must stay equal to the allocator it was moved to and keep deallocating its memory.
+    /// \param other The allocator whose arena is shared.
+    /// \post Constructs an allocator that compares equal to `other`.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    PoolAllocator(const PoolAllocator& other) noexcept
+        : m_arena(other.m_arena), m_pool(other.m_pool)
+    {
+    }
+
+    /// Copy assignment operator, also used for moves so the source keeps sharing the arena.
+    /// \param other The allocator whose arena is shared.
+    /// \return Reference to this allocator.
+    /// \post The allocator compares equal to `other`.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    PoolAllocator& operator=(const PoolAllocator& other) noexcept
+    {
+        m_arena = other.m_arena;
+        m_pool = other.m_pool;
+        return *this;
+    }
+
+    /// Rebinding constructor.
+    /// \param other The allocator for another type whose arena is shared.
+    /// \tparam U The type allocated by `other`.
+    /// \post Constructs an allocator that compares equal to `other`.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U>& other) noexcept
+        : m_arena(other.arena())
+    {
+    }
+
+    /// Get the largest amount of objects that allocate() can be asked for.
+    /// \return The amount of objects whose total size fits in std::size_t.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    std::size_t max_size() const noexcept
+    {
+        return std::numeric_limits<std::size_t>::max() / sizeof(T);
+    }
+
+    /// Allocate storage for objects.
+    /// \param n The amount of objects.
+    /// \return Pointer to uninitialized storage for `n` objects.
+    /// \exception std::bad_array_new_length if `n` is greater than max_size().
+    /// \exception std::bad_alloc if memory allocation fails.
+    /// \par Time complexity:
+    /// - O(1).
+    T* allocate(std::size_t n)
+    {
+        if (n != 1)
+        {
+            if (n > max_size())
+            {
+                throw std::bad_array_new_length();
+            }
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(pool().allocate());
+    }
+
+    /// Deallocate storage for objects.
+    /// \param pointer Pointer returned by allocate() of an allocator that compares equal to this one.
+    /// \param n The amount of objects passed to allocate().
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    void deallocate(T* pointer, std::size_t n) noexcept
+    {
+        if (n != 1)
+        {
+            ::operator delete(pointer);
+            return;
+        }
+        if (!m_pool)
+        {
+            // Memory allocated through a copy of this allocator, the pool exists already.
+            m_pool = m_arena->find(sizeof(T), alignof(T));
+        }
+        m_pool->deallocate(pointer);
+    }
+
+    /// Deallocate every single object at once, if the caller owns every object allocated from the pool of T.
+    /// \param owned The amount of objects the caller has allocated one at a time and not deallocated.
+    /// \return True if the memory was released, false if other objects from the same pool are still in use.
+    /// \pre The objects must have been destroyed already.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(c) Where c is the amount of chunks in the pool.
+    bool release(std::size_t owned) noexcept
+    {
+        PoolArena::Pool* pool = m_pool ? m_pool : m_arena->find(sizeof(T), alignof(T));
+        return pool ? pool->release(owned) : owned == 0;
+    }
+
+    /// Get the arena of the allocator.
+    /// \return The arena shared with the copies and rebinds of this allocator.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const std::shared_ptr<PoolArena>& arena() const noexcept
+    {
+        return m_arena;
+    }
+
+private:
+    /// Get the pool for T, looking it up from the arena on first use.
+    /// \return The pool of the arena that fits T.
+    PoolArena::Pool& pool()
+    {
+        if (!m_pool)
+        {
+            m_pool = &m_arena->pool(sizeof(T), alignof(T));
+        }
+        return *m_pool;
+    }
+
+    /// The arena shared with the copies and rebinds of this allocator.
+    std::shared_ptr<PoolArena> m_arena;
+
+    /// The pool for T, null until the first allocation.
+    PoolArena::Pool* m_pool = nullptr;
+};
+
+/// Check whether memory from one allocator can be deallocated with the other.
+/// \param lhs The first allocator.
+/// \param rhs The second allocator.
+/// \return True if the allocators share an arena.
+/// \exception noexcept No exceptions are thrown by this operation.
+template <typename T, typename U>
+bool operator==(const PoolAllocator<T>& lhs, const PoolAllocator<U>& rhs) noexcept
+{
+    return lhs.arena() == rhs.arena();
+}
+
+/// Check whether memory from one allocator can not be deallocated with the other.
+/// \param lhs The first allocator.
+/// \param rhs The second allocator.
+/// \return True if the allocators use different arenas.
+/// \exception noexcept No exceptions are thrown by this operation.
+template <typename T, typename U>
+bool operator!=(const PoolAllocator<T>& lhs, const PoolAllocator<U>& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+#endif
@@ -0,0 +1,315 @@
+#ifndef SIMD_SEARCH_HPP
+#define SIMD_SEARCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+
+// The vector kernels need the GCC/Clang target attribute and x86-64, where SSE2 is always available.
+// Define BAG_CONTAINER_ADAPTOR_NO_SIMD to always use the scalar loops.
+#if !defined(BAG_CONTAINER_ADAPTOR_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#define BAG_CONTAINER_ADAPTOR_SIMD 1
+#include <immintrin.h>
+#else
+#define BAG_CONTAINER_ADAPTOR_SIMD 0
+#endif
+
+/// Tells whether elements of type T can be compared for equality with packed SIMD compares.
+/// Integral types of 1, 2, 4 or 8 bytes other than bool, float and double are supported.
+/// \tparam T The type of the compared elements.
+template <typename T>
+struct IsSimdSearchable
+    : std::integral_constant<bool, BAG_CONTAINER_ADAPTOR_SIMD &&
+                                       ((std::is_integral<T>::value && !std::is_same<T, bool>::value &&
+                                         (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8)) ||
+                                        std::is_same<T, float>::value || std::is_same<T, double>::value)>
+{
+};
+
+/// Searching a contiguous range for a value with a scalar loop.
+/// This is the fallback for element types that can not be compared with packed compares.
+/// \tparam T The type of the searched elements.
+template <typename T, bool = IsSimdSearchable<T>::value>
+class SimdSearch
+{
+public:
+    /// Find the first element equal to the value.
+    /// \param first Pointer to the first element of the range.
+    /// \param last Pointer one past the last element of the range.
+    /// \param value The value to search for.
+    /// \return Pointer to the first element equal to `value`, or `last` if there is none.
+    static const T* find(const T* first, const T* last, const T& value)
+    {
+        return std::find(first, last, value);
+    }
+
+    /// Count the elements equal to the value.
+    /// \param first Pointer to the first element of the range.
+    /// \param last Pointer one past the last element of the range.
+    /// \param value The value to count.
+    /// \return The amount of elements equal to `value`.
+    static std::size_t count(const T* first, const T* last, const T& value)
+    {
+        return static_cast<std::size_t>(std::count(first, last, value));
+    }
+};
+
+#if BAG_CONTAINER_ADAPTOR_SIMD
+
+/// Packed equality compares for integral elements of the given size.
+/// Every compare sets all bits of the lanes that are equal, so the byte mask of the result has
+/// sizeof(T) consecutive bits set for each equal element.
+/// \tparam Size The size of the compared elements in bytes.
+template <std::size_t Size>
+struct SimdEqual;
+
+template <>
+struct SimdEqual<1>
+{
+    static __m128i compare(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi8(a, b);
+    }
+
+    __attribute__((target("avx2"))) static __m256i compare(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi8(a, b);
+    }
+};
+
+template <>
+struct SimdEqual<2>
+{
+    static __m128i compare(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi16(a, b);
+    }
+
+    __attribute__((target("avx2"))) static __m256i compare(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi16(a, b);
+    }
+};
+
+template <>
+struct SimdEqual<4>
+{
+    static __m128i compare(__m128i a, __m128i b)
+    {
+        return _mm_cmpeq_epi32(a, b);
+    }
+
+    __attribute__((target("avx2"))) static __m256i compare(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi32(a, b);
+    }
+};
+
+template <>
+struct SimdEqual<8>
+{
+    static __m128i compare(__m128i a, __m128i b)
+    {
+        // SSE2 has no 64-bit compare, both 32-bit halves have to be equal.
+        const __m128i halves = _mm_cmpeq_epi32(a, b);
+        return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+    }
+
+    __attribute__((target("avx2"))) static __m256i compare(__m256i a, __m256i b)
+    {
+        return _mm256_cmpeq_epi64(a, b);
+    }
+};
+
+/// Packed equality compares for float, which follow the scalar operator== for zeros and NaN.
+struct SimdEqualFloat
+{
+    static __m128i compare(__m128i a, __m128i b)
+    {
+        return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+    }
+
+    __attribute__((target("avx2"))) static __m256i compare(__m256i a, __m256i b)
+    {
+        return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+    }
+};
+
+/// Packed equality compares for double, which follow the scalar operator== for zeros and NaN.
+struct SimdEqualDouble
+{
+    static __m128i compare(__m128i a, __m128i b)
+    {
+        return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+    }
+
+    __attribute__((target("avx2"))) static __m256i compare(__m256i a, __m256i b)
+    {
+        return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+    }
+};
+
+/// Searching a contiguous range for a value with SSE2 or AVX2 compare-and-movemask loops.
+/// The AVX2 loops are compiled regardless of the compiler flags and used when the CPU supports them,
+/// the SSE2 loops are used otherwise. The elements that do not fill a whole register are handled with a scalar loop.
+/// \tparam T The type of the searched elements.
+template <typename T>
+class SimdSearch<T, true>
+{
+public:
+    /// Find the first element equal to the value.
+    /// \param first Pointer to the first element of the range.
+    /// \param last Pointer one past the last element of the range.
+    /// \param value The value to search for.
+    /// \return Pointer to the first element equal to `value`, or `last` if there is none.
+    /// \par Time complexity:
+    /// - O(n) With sizeof(T) / 16 or sizeof(T) / 32 of the compares done by the scalar loop.
+    static const T* find(const T* first, const T* last, const T& value)
+    {
+        return hasAvx2() ? findAvx2(first, last, value) : findSse2(first, last, value);
+    }
+
+    /// Count the elements equal to the value.
+    /// \param first Pointer to the first element of the range.
+    /// \param last Pointer one past the last element of the range.
+    /// \param value The value to count.
+    /// \return The amount of elements equal to `value`.
+    static std::size_t count(const T* first, const T* last, const T& value)
+    {
+        return hasAvx2() ? countAvx2(first, last, value) : countSse2(first, last, value);
+    }
+
+    /// Check once whether the CPU supports AVX2, and the POPCNT instruction used by the AVX2 count.
+    /// \return True if the AVX2 kernels can be used.
+    static bool hasAvx2()
+    {
+#if defined(__AVX2__) && defined(__POPCNT__)
+        return true;
+#else
+        static const bool supported = __builtin_cpu_supports("avx2") != 0 && __builtin_cpu_supports("popcnt") != 0;
+        return supported;
+#endif
+    }
+
+    /// Find the first element equal to the value with 16 byte compares.
+    /// The kernels are usable directly so that both of them can be tested on any CPU that has AVX2.
+    /// \param first Pointer to the first element of the range.
+    /// \param last Pointer one past the last element of the range.
+    /// \param value The value to search for.
+    /// \return Pointer to the first element equal to `value`, or `last` if there is none.
+    static const T* findSse2(const T* first, const T* last, const T& value)
+    {
+        constexpr std::size_t width = 16 / sizeof(T);
+        T lanes[width];
+        std::fill(lanes, lanes + width, value);
+        const __m128i needle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes));
+
+        for (; static_cast<std::size_t>(last - first) >= width; first += width)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            const auto mask = static_cast<unsigned>(_mm_movemask_epi8(Equal::compare(block, needle)));
+            if (mask != 0)
+            {
+                return first + firstElement(mask);
+            }
+        }
+        return std::find(first, last, value);
+    }
+
+    /// Find the first element equal to the value with 32 byte compares.
+    /// \param first Pointer to the first element of the range.
+    /// \param last Pointer one past the last element of the range.
+    /// \param value The value to search for.
+    /// \return Pointer to the first element equal to `value`, or `last` if there is none.
+    /// \pre The CPU must support AVX2.
+    __attribute__((target("avx2"))) static const T* findAvx2(const T* first, const T* last, const T& value)
+    {
+        constexpr std::size_t width = 32 / sizeof(T);
+        T lanes[width];
+        std::fill(lanes, lanes + width, value);
+        const __m256i needle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes));
+
+        for (; static_cast<std::size_t>(last - first) >= width; first += width)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(Equal::compare(block, needle)));
+            if (mask != 0)
+            {
+                return first + firstElement(mask);
+            }
+        }
+        return std::find(first, last, value);
+    }
+
+    /// Count the elements equal to the value with 16 byte compares.
+    /// \param first Pointer to the first element of the range.
+    /// \param last Pointer one past the last element of the range.
+    /// \param value The value to count.
+    /// \return The amount of elements equal to `value`.
+    static std::size_t countSse2(const T* first, const T* last, const T& value)
+    {
+        constexpr std::size_t width = 16 / sizeof(T);
+        T lanes[width];
+        std::fill(lanes, lanes + width, value);
+        const __m128i needle = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes));
+
+        // Every equal element sets sizeof(T) bits of the byte mask.
+        std::size_t bits = 0;
+        for (; static_cast<std::size_t>(last - first) >= width; first += width)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            const auto mask = static_cast<unsigned>(_mm_movemask_epi8(Equal::compare(block, needle)));
+            bits += countBits(mask);
+        }
+        return bits / sizeof(T) + static_cast<std::size_t>(std::count(first, last, value));
+    }
+
+    /// Count the elements equal to the value with 32 byte compares.
+    /// \param first Pointer to the first element of the range.
+    /// \param last Pointer one past the last element of the range.
+    /// \param value The value to count.
+    /// \return The amount of elements equal to `value`.
+    /// \pre The CPU must support AVX2 and POPCNT.
+    __attribute__((target("avx2,popcnt"))) static std::size_t countAvx2(const T* first, const T* last, const T& value)
+    {
+        constexpr std::size_t width = 32 / sizeof(T);
+        T lanes[width];
+        std::fill(lanes, lanes + width, value);
+        const __m256i needle = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes));
+
+        // Every equal element sets sizeof(T) bits of the byte mask.
+        std::size_t bits = 0;
+        for (; static_cast<std::size_t>(last - first) >= width; first += width)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            const auto mask = static_cast<unsigned>(_mm256_movemask_epi8(Equal::compare(block, needle)));
+            bits += static_cast<std::size_t>(__builtin_popcount(mask));
+        }
+        return bits / sizeof(T) + static_cast<std::size_t>(std::count(first, last, value));
+    }
+
+private:
+    /// The compares used for T.
+    using Equal = typename std::conditional<
+        std::is_same<T, float>::value, SimdEqualFloat,
+        typename std::conditional<std::is_same<T, double>::value, SimdEqualDouble, SimdEqual<sizeof(T)>>::type>::type;
+
+    /// Count the set bits of a byte mask with plain integer operations.
+    /// The SSE2 kernel also runs on CPUs without POPCNT, where __builtin_popcount becomes a library call for every block.
+    static std::size_t countBits(unsigned mask)
+    {
+        mask = mask - ((mask >> 1) & 0x55555555u);
+        mask = (mask & 0x33333333u) + ((mask >> 2) & 0x33333333u);
+        return static_cast<std::size_t>((((mask + (mask >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24);
+    }
+
+    /// Turn the byte mask of a compare result into the index of the first equal element.
+    static std::size_t firstElement(unsigned mask)
+    {
+        return static_cast<std::size_t>(__builtin_ctz(mask)) / sizeof(T);
+    }
+};
+
+#endif
+
+#endif
@@ -0,0 +1,479 @@
+#ifndef SLOT_MAP_HPP
+#define SLOT_MAP_HPP
+
+#include "simd_search.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+/// A stable reference to an element of SlotMap.
+/// The handle stays valid while the element lives, however other elements are inserted and erased,
+/// and it is recognized as stale once the element is erased, even if its slot is reused.
+struct SlotMapHandle
+{
+    /// Equality operator.
+    /// \param other The handle to compare with.
+    /// \return True if both handles refer to the same slot and generation.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool operator==(const SlotMapHandle& other) const noexcept
+    {
+        return m_slot == other.m_slot && m_generation == other.m_generation;
+    }
+
+    /// Inequality operator.
+    /// \param other The handle to compare with.
+    /// \return True if the handles refer to different slots or generations.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool operator!=(const SlotMapHandle& other) const noexcept
+    {
+        return !(*this == other);
+    }
+
+    /// The slot of the element in the sparse handle table.
+    std::uint32_t m_slot = 0;
+
+    /// The generation of the slot when the element was inserted, always odd for handles of inserted elements.
+    std::uint32_t m_generation = 0;
+};
+
+/// SlotMap stores its elements contiguously and hands out a stable SlotMapHandle for each of them.
+/// A sparse table of slots maps every handle to the current position of its element in the dense storage,
+/// and the dense storage remembers the slot of each element. Erasing moves the last element into the hole
+/// and updates the slot of the moved element, so handles stay valid while iterators and positions do not.
+/// Each slot has a generation that is incremented when an element is inserted to it and when it is erased,
+/// so occupied slots have odd generations and handles to erased elements never match again.
+/// \tparam T The type of elements stored in the slot map.
+/// \note Generations are 32-bit and wrap around after about two billion reuses of the same slot.
+template <typename T>
+class SlotMap
+{
+public:
+    /// The type of items stored in the slot map.
+    using value_type = T;
+
+    /// The type used for the amount of elements.
+    using size_type = std::size_t;
+
+    /// The stable reference to an element.
+    using handle_type = SlotMapHandle;
+
+    /// An iterator over the dense storage.
+    using iterator = typename std::vector<T>::iterator;
+
+    /// A constant iterator over the dense storage.
+    using const_iterator = typename std::vector<T>::const_iterator;
+
+    /// Default constructor.
+    /// \post Constructs an empty `SlotMap`.
+    SlotMap() = default;
+
+    /// Initializer list constructor.
+    /// \param list An initializer list containing values to initialize the slot map with.
+    /// \post Constructs a new `SlotMap` with the elements from the initializer list.
+    /// \exception std::bad_alloc if memory allocation fails.
+    SlotMap(std::initializer_list<T> list)
+    {
+        reserve(list.size());
+        for (const auto& value : list)
+        {
+            insert(value);
+        }
+    }
+
+    /// Get an iterator to the first element.
+    /// \return An iterator to the first element in the dense storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator begin() noexcept
+    {
+        return m_values.begin();
+    }
+
+    /// Get an iterator past the last element.
+    /// \return An iterator one past the last element in the dense storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator end() noexcept
+    {
+        return m_values.end();
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first element in the dense storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator begin() const noexcept
+    {
+        return m_values.cbegin();
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator one past the last element in the dense storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator end() const noexcept
+    {
+        return m_values.cend();
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first element in the dense storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cbegin() const noexcept
+    {
+        return m_values.cbegin();
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator one past the last element in the dense storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cend() const noexcept
+    {
+        return m_values.cend();
+    }
+
+    /// Returns a constant reference to the first element.
+    /// \return A constant reference to the first element in the dense storage.
+    /// \pre The slot map must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& front() const noexcept
+    {
+        return m_values.front();
+    }
+
+    /// Returns a constant reference to the last element.
+    /// \return A constant reference to the last element in the dense storage.
+    /// \pre The slot map must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& back() const noexcept
+    {
+        return m_values.back();
+    }
+
+    /// Returns the number of elements.
+    /// \return The number of elements in the slot map.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    size_type size() const noexcept
+    {
+        return m_values.size();
+    }
+
+    /// Checks whether the slot map is empty.
+    /// \return True if the slot map is empty, otherwise false.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool empty() const noexcept
+    {
+        return m_values.empty();
+    }
+
+    /// Reserve the dense storage and the handle table for the specified amount of elements.
+    /// \param count The expected amount of elements.
+    /// \post Inserting up to `count` elements does not reallocate.
+    /// \exception std::length_error if `count` is too large, std::bad_alloc if memory allocation fails.
+    void reserve(size_type count)
+    {
+        m_values.reserve(count);
+        m_owners.reserve(count);
+        m_slots.reserve(count);
+    }
+
+    /// Erase all elements.
+    /// \post The slot map is empty and the handles of all erased elements are stale.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void clear() noexcept
+    {
+        while (!m_values.empty())
+        {
+            eraseAt(m_values.size() - 1);
+        }
+    }
+
+    /// Construct an element in place at the end of the dense storage.
+    /// \param args The arguments forwarded to the constructor of the element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return A handle that refers to the new element until it is erased.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the constructor of the element.
+    ///            The slot map is left unchanged.
+    /// \par Time complexity:
+    /// - Amortized O(1).
+    template <typename... Args>
+    handle_type emplace(Args&&... args)
+    {
+        // A new slot joins the free list first, so it stays there if the element can not be constructed.
+        if (m_freeHead == noSlot)
+        {
+            m_slots.push_back(Slot{noSlot, 0});
+            m_freeHead = static_cast<std::uint32_t>(m_slots.size() - 1);
+        }
+
+        const std::uint32_t slot = m_freeHead;
+        m_owners.push_back(slot);
+        try
+        {
+            m_values.emplace_back(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            m_owners.pop_back();
+            throw;
+        }
+
+        Slot& entry = m_slots[slot];
+        m_freeHead = entry.m_position;
+        entry.m_position = static_cast<std::uint32_t>(m_values.size() - 1);
+        ++entry.m_generation;
+        return handle_type{slot, entry.m_generation};
+    }
+
+    /// Insert a copy of a value.
+    /// \param value The value to be inserted.
+    /// \return A handle that refers to the new element until it is erased.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the element.
+    handle_type insert(const T& value)
+    {
+        return emplace(value);
+    }
+
+    /// Insert a value by moving it.
+    /// \param value The value to be moved into the slot map.
+    /// \return A handle that refers to the new element until it is erased.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the move constructor of the element.
+    handle_type insert(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /// Erase the element that a handle refers to.
+    /// \param handle The handle of the element.
+    /// \return True if the element was erased, false if the handle was stale.
+    /// \post The last element of the dense storage is moved into the hole, its handle stays valid.
+    /// \exception Any exception thrown by the move assignment of the elements.
+    /// \par Time complexity:
+    /// - O(1).
+    bool erase(handle_type handle)
+    {
+        if (!contains(handle))
+        {
+            return false;
+        }
+
+        eraseAt(m_slots[handle.m_slot].m_position);
+        return true;
+    }
+
+    /// Erase the element at a position of the dense storage.
+    /// \param pos An iterator pointing to the element to be erased.
+    /// \return An iterator to the same position, which holds the previously last element, or end().
+    /// \pre The provided iterator must be valid and dereferenceable.
+    /// \exception Any exception thrown by the move assignment of the elements.
+    /// \par Time complexity:
+    /// - O(1).
+    iterator erase(const_iterator pos)
+    {
+        const auto position = static_cast<size_type>(pos - m_values.cbegin());
+        eraseAt(position);
+        return m_values.begin() + static_cast<std::ptrdiff_t>(position);
+    }
+
+    /// Erase all elements that satisfy a predicate.
+    /// \param pred The unary predicate that returns true for the removed elements.
+    /// \tparam Predicate The type of the predicate.
+    /// \return The amount of removed elements.
+    /// \post The handles of the remaining elements stay valid.
+    /// \exception Any exception thrown by `pred` or by the move assignment of the elements.
+    template <typename Predicate>
+    size_type erase_if(Predicate pred)
+    {
+        const size_type before = m_values.size();
+
+        // Walking backwards, the element moved into a hole has already been tested.
+        for (size_type position = m_values.size(); position-- > 0;)
+        {
+            if (pred(m_values[position]))
+            {
+                eraseAt(position);
+            }
+        }
+        return before - m_values.size();
+    }
+
+    /// Checks whether a handle refers to an element of the slot map.
+    /// \param handle The handle to check.
+    /// \return True if the element of the handle has not been erased, otherwise false.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool contains(handle_type handle) const noexcept
+    {
+        return handle.m_slot < m_slots.size() && m_slots[handle.m_slot].m_generation == handle.m_generation &&
+               (handle.m_generation & 1u) != 0;
+    }
+
+    /// Find the element that a handle refers to.
+    /// \param handle The handle of the element.
+    /// \return An iterator to the element, or end() if the handle is stale.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    iterator find(handle_type handle) noexcept
+    {
+        return contains(handle) ? m_values.begin() + static_cast<std::ptrdiff_t>(m_slots[handle.m_slot].m_position) : m_values.end();
+    }
+
+    /// Find the element that a handle refers to in const context.
+    /// \param handle The handle of the element.
+    /// \return A constant iterator to the element, or end() if the handle is stale.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator find(handle_type handle) const noexcept
+    {
+        return contains(handle) ? m_values.cbegin() + static_cast<std::ptrdiff_t>(m_slots[handle.m_slot].m_position) : m_values.cend();
+    }
+
+    /// Find the first element equal to a value.
+    /// \param value The value to search for.
+    /// \return An iterator to the first element equal to `value` in the dense storage, or end() if there is none.
+    /// \exception Any exception thrown by the comparison of the elements.
+    iterator find(const T& value)
+    {
+        return m_values.begin() + (static_cast<const SlotMap&>(*this).find(value) - m_values.cbegin());
+    }
+
+    /// Find the first element equal to a value in const context.
+    /// \param value The value to search for.
+    /// \return A constant iterator to the first element equal to `value`, or end() if there is none.
+    /// \exception Any exception thrown by the comparison of the elements.
+    /// \note The dense storage is searched with packed compares for arithmetic types.
+    const_iterator find(const T& value) const
+    {
+        const T* data = m_values.data();
+        return m_values.cbegin() + (SimdSearch<T>::find(data, data + m_values.size(), value) - data);
+    }
+
+    /// Count the elements equal to a value.
+    /// \param value The value to count.
+    /// \return The amount of elements equal to `value`.
+    /// \exception Any exception thrown by the comparison of the elements.
+    size_type count(const T& value) const
+    {
+        return SimdSearch<T>::count(m_values.data(), m_values.data() + m_values.size(), value);
+    }
+
+    /// Access the element that a handle refers to.
+    /// \param handle The handle of the element.
+    /// \return A reference to the element.
+    /// \pre The handle must not be stale.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    T& operator[](handle_type handle) noexcept
+    {
+        return m_values[m_slots[handle.m_slot].m_position];
+    }
+
+    /// Access the element that a handle refers to in const context.
+    /// \param handle The handle of the element.
+    /// \return A constant reference to the element.
+    /// \pre The handle must not be stale.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& operator[](handle_type handle) const noexcept
+    {
+        return m_values[m_slots[handle.m_slot].m_position];
+    }
+
+    /// Access the element that a handle refers to with a check.
+    /// \param handle The handle of the element.
+    /// \return A reference to the element.
+    /// \exception std::out_of_range if the handle is stale.
+    T& at(handle_type handle)
+    {
+        if (!contains(handle))
+        {
+            throw std::out_of_range("SlotMap::at: stale handle");
+        }
+        return (*this)[handle];
+    }
+
+    /// Access the element that a handle refers to with a check in const context.
+    /// \param handle The handle of the element.
+    /// \return A constant reference to the element.
+    /// \exception std::out_of_range if the handle is stale.
+    const T& at(handle_type handle) const
+    {
+        if (!contains(handle))
+        {
+            throw std::out_of_range("SlotMap::at: stale handle");
+        }
+        return (*this)[handle];
+    }
+
+    /// Get the handle of the element at a position of the dense storage.
+    /// \param pos An iterator pointing to the element.
+    /// \return The handle that refers to the element.
+    /// \pre The provided iterator must be valid and dereferenceable.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    handle_type handle(const_iterator pos) const noexcept
+    {
+        const std::uint32_t slot = m_owners[static_cast<size_type>(pos - m_values.cbegin())];
+        return handle_type{slot, m_slots[slot].m_generation};
+    }
+
+    /// Swap the contents of this slot map with another slot map.
+    /// \param other The other slot map to swap with.
+    /// \post Handles refer to the elements in the slot map that now holds them.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swap(SlotMap& other) noexcept
+    {
+        m_values.swap(other.m_values);
+        m_owners.swap(other.m_owners);
+        m_slots.swap(other.m_slots);
+        std::swap(m_freeHead, other.m_freeHead);
+    }
+
+private:
+    /// An entry of the sparse handle table.
+    struct Slot
+    {
+        /// The position of the element in the dense storage, or the next free slot while the slot is free.
+        std::uint32_t m_position = 0;
+
+        /// Incremented on every insert and erase, odd while the slot holds an element.
+        std::uint32_t m_generation = 0;
+    };
+
+    /// Marks the end of the free list.
+    static constexpr std::uint32_t noSlot = ~std::uint32_t(0);
+
+    /// Erase the element at a position by moving the last element into it, and free its slot.
+    void eraseAt(size_type position)
+    {
+        const size_type last = m_values.size() - 1;
+        const std::uint32_t slot = m_owners[position];
+
+        if (position != last)
+        {
+            m_values[position] = std::move(m_values[last]);
+            m_owners[position] = m_owners[last];
+            m_slots[m_owners[position]].m_position = static_cast<std::uint32_t>(position);
+        }
+        m_values.pop_back();
+        m_owners.pop_back();
+
+        Slot& entry = m_slots[slot];
+        ++entry.m_generation;
+        entry.m_position = m_freeHead;
+        m_freeHead = slot;
+    }
+
+    /// The elements, contiguous for iteration.
+    std::vector<T> m_values;
+
+    /// The slot of each element in the dense storage.
+    std::vector<std::uint32_t> m_owners;
+
+    /// The sparse handle table, indexed by the slot of a handle.
+    std::vector<Slot> m_slots;
+
+    /// The first free slot, the free slots are linked through their positions.
+    std::uint32_t m_freeHead = noSlot;
+};
+
+template <typename T>
+constexpr std::uint32_t SlotMap<T>::noSlot;
+
+#endif
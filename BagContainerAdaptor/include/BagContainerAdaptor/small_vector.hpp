@@ -0,0 +1,567 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/// SmallVector stores up to N elements inside the object itself and moves them to the heap only when more are inserted,
+/// so small containers never allocate. Once on the heap the elements stay there, growing geometrically like std::vector,
+/// until the container is moved from or swapped. The elements are contiguous in both cases and iterators are pointers.
+/// \tparam T The type of elements stored in the small vector.
+/// \tparam N The amount of elements stored inline before spilling to the heap.
+template <typename T, std::size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "SmallVector needs room for at least one inline element.");
+
+public:
+    /// The type of items stored in the small vector.
+    using value_type = T;
+
+    /// The type used for the amount of elements.
+    using size_type = std::size_t;
+
+    /// A random access iterator over the elements.
+    using iterator = T*;
+
+    /// A constant random access iterator over the elements.
+    using const_iterator = const T*;
+
+    /// The amount of elements stored inline.
+    static constexpr size_type inlineCapacity = N;
+
+    /// Default constructor.
+    /// \post Constructs an empty small vector using the inline storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    SmallVector() noexcept
+        : m_data(inlineData())
+    {
+    }
+
+    /// Initializer list constructor.
+    /// \param list An initializer list containing values to initialize the small vector with.
+    /// \post Constructs a small vector with the elements from the initializer list, on the heap only if there are more than N.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the elements.
+    SmallVector(std::initializer_list<T> list)
+        : SmallVector()
+    {
+        appendAll(list.begin(), list.end());
+    }
+
+    /// Copy constructor.
+    /// \param other The small vector to be copied from.
+    /// \post Constructs a small vector with copies of the elements, on the heap only if there are more than N.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the elements.
+    SmallVector(const SmallVector& other)
+        : SmallVector()
+    {
+        appendAll(other.begin(), other.end());
+    }
+
+    /// Move constructor.
+    /// \param other The small vector to be moved from, left empty.
+    /// \post Heap storage is taken over, inline elements are moved one by one.
+    /// \exception Any exception thrown by the move constructor of the elements.
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+        : SmallVector()
+    {
+        takeFrom(other);
+    }
+
+    /// Destructor.
+    /// \post Destroys all elements and deallocates the heap storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    ~SmallVector() noexcept
+    {
+        clear();
+        releaseHeap();
+    }
+
+    /// Copy assignment operator.
+    /// \param other The small vector to be assigned from.
+    /// \return A reference to this small vector.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the elements.
+    ///            This small vector is left unchanged.
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (this != &other)
+        {
+            SmallVector copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /// Move assignment operator.
+    /// \param other The small vector to be moved from, left empty.
+    /// \return A reference to this small vector.
+    /// \exception Any exception thrown by the move constructor of the elements.
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (this != &other)
+        {
+            clear();
+            releaseHeap();
+            takeFrom(other);
+        }
+        return *this;
+    }
+
+    /// Get an iterator to the first element.
+    /// \return A pointer to the first element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator begin() noexcept
+    {
+        return m_data;
+    }
+
+    /// Get an iterator past the last element.
+    /// \return A pointer one past the last element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator end() noexcept
+    {
+        return m_data + m_size;
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant pointer to the first element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator begin() const noexcept
+    {
+        return m_data;
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant pointer one past the last element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator end() const noexcept
+    {
+        return m_data + m_size;
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant pointer to the first element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cbegin() const noexcept
+    {
+        return m_data;
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant pointer one past the last element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cend() const noexcept
+    {
+        return m_data + m_size;
+    }
+
+    /// Get the contiguous storage.
+    /// \return A pointer to the first element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    T* data() noexcept
+    {
+        return m_data;
+    }
+
+    /// Get the contiguous storage in const context.
+    /// \return A constant pointer to the first element.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T* data() const noexcept
+    {
+        return m_data;
+    }
+
+    /// Access an element by position.
+    /// \param position The position of the element.
+    /// \return A reference to the element.
+    /// \pre `position` must be less than size().
+    /// \exception noexcept No exceptions are thrown by this operation.
+    T& operator[](size_type position) noexcept
+    {
+        return m_data[position];
+    }
+
+    /// Access an element by position in const context.
+    /// \param position The position of the element.
+    /// \return A constant reference to the element.
+    /// \pre `position` must be less than size().
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& operator[](size_type position) const noexcept
+    {
+        return m_data[position];
+    }
+
+    /// Returns a reference to the first element.
+    /// \return A reference to the first element.
+    /// \pre The small vector must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    T& front() noexcept
+    {
+        return m_data[0];
+    }
+
+    /// Returns a constant reference to the first element.
+    /// \return A constant reference to the first element.
+    /// \pre The small vector must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& front() const noexcept
+    {
+        return m_data[0];
+    }
+
+    /// Returns a reference to the last element.
+    /// \return A reference to the last element.
+    /// \pre The small vector must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    T& back() noexcept
+    {
+        return m_data[m_size - 1];
+    }
+
+    /// Returns a constant reference to the last element.
+    /// \return A constant reference to the last element.
+    /// \pre The small vector must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& back() const noexcept
+    {
+        return m_data[m_size - 1];
+    }
+
+    /// Returns the number of elements.
+    /// \return The number of elements in the small vector.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// Checks whether the small vector is empty.
+    /// \return True if the small vector is empty, otherwise false.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /// Returns the amount of elements that fit without allocating.
+    /// \return N while the elements are inline, otherwise the capacity of the heap storage.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    size_type capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /// Checks whether the elements are stored inside the object.
+    /// \return True if the inline storage is in use, false if the elements have spilled to the heap.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool isInline() const noexcept
+    {
+        return m_data == inlineData();
+    }
+
+    /// Make room for the specified amount of elements.
+    /// \param count The expected amount of elements.
+    /// \post capacity() is at least `count`. Nothing is allocated if `count` fits in the current storage.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the move constructor of the elements.
+    void reserve(size_type count)
+    {
+        if (count > m_capacity)
+        {
+            reallocate(count);
+        }
+    }
+
+    /// Destroy all elements.
+    /// \post The small vector is empty, the storage in use is kept.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void clear() noexcept
+    {
+        destroyRange(m_data, m_data + m_size);
+        m_size = 0;
+    }
+
+    /// Construct a new element in place at the end.
+    /// \param args The arguments forwarded to the constructor of the element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return A reference to the new element.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the constructors of the elements.
+    ///            The small vector is left unchanged.
+    /// \par Time complexity:
+    /// - Amortized O(1).
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (m_size == m_capacity)
+        {
+            return emplaceBackGrowing(std::forward<Args>(args)...);
+        }
+
+        ::new (static_cast<void*>(m_data + m_size)) T(std::forward<Args>(args)...);
+        return m_data[m_size++];
+    }
+
+    /// Insert a copy of a value at the end.
+    /// \param value The value to be inserted.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the constructors of the elements.
+    void push_back(const T& value)
+    {
+        emplace_back(value);
+    }
+
+    /// Insert a value at the end by moving it.
+    /// \param value The value to be moved into the small vector.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the constructors of the elements.
+    void push_back(T&& value)
+    {
+        emplace_back(std::move(value));
+    }
+
+    /// Construct a new element in place in front of a position.
+    /// \param pos An iterator pointing to the position where the element is inserted.
+    /// \param args The arguments forwarded to the constructor of the element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return An iterator to the new element.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the constructors or the move assignment of the elements.
+    /// \par Time complexity:
+    /// - O(n) Where n is the amount of elements after `pos`.
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)
+    {
+        const auto offset = pos - m_data;
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(m_data + offset, m_data + m_size - 1, m_data + m_size);
+        return m_data + offset;
+    }
+
+    /// Insert a copy of a value in front of a position.
+    /// \param pos An iterator pointing to the position where the element is inserted.
+    /// \param value The value to be inserted.
+    /// \return An iterator to the new element.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the constructors or the move assignment of the elements.
+    iterator insert(const_iterator pos, const T& value)
+    {
+        return emplace(pos, value);
+    }
+
+    /// Insert a value in front of a position by moving it.
+    /// \param pos An iterator pointing to the position where the element is inserted.
+    /// \param value The value to be moved into the small vector.
+    /// \return An iterator to the new element.
+    /// \exception std::bad_alloc if memory allocation fails, or any exception thrown by the constructors or the move assignment of the elements.
+    iterator insert(const_iterator pos, T&& value)
+    {
+        return emplace(pos, std::move(value));
+    }
+
+    /// Remove the last element.
+    /// \pre The small vector must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void pop_back() noexcept
+    {
+        m_data[--m_size].~T();
+    }
+
+    /// Remove the element at a position, keeping the order of the other elements.
+    /// \param pos An iterator pointing to the element to be removed.
+    /// \return An iterator to the element that followed the removed element.
+    /// \pre The provided iterator must be valid and dereferenceable.
+    /// \exception Any exception thrown by the move assignment of the elements.
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    /// Remove the elements in the range [first, last), keeping the order of the other elements.
+    /// \param first An iterator pointing to the first element to be removed.
+    /// \param last An iterator pointing one past the last element to be removed.
+    /// \return An iterator to the element that followed the removed range.
+    /// \pre The range [first, last) must be a valid range within the small vector.
+    /// \exception Any exception thrown by the move assignment of the elements.
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        T* const begin = m_data + (first - m_data);
+        T* const newEnd = std::move(m_data + (last - m_data), end(), begin);
+        destroyRange(newEnd, end());
+        m_size = static_cast<size_type>(newEnd - m_data);
+        return begin;
+    }
+
+    /// Swap the contents of this small vector with another small vector.
+    /// \param other The other small vector to swap with.
+    /// \post Heap storage is exchanged, inline elements are moved between the objects.
+    /// \exception Any exception thrown by the move constructor of the elements.
+    void swap(SmallVector& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (!isInline() && !other.isInline())
+        {
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+            std::swap(m_capacity, other.m_capacity);
+            return;
+        }
+
+        SmallVector temporary(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temporary);
+    }
+
+private:
+    /// The inline storage as elements.
+    T* inlineData() noexcept
+    {
+        return reinterpret_cast<T*>(m_inline);
+    }
+
+    /// The inline storage as elements in const context.
+    const T* inlineData() const noexcept
+    {
+        return reinterpret_cast<const T*>(m_inline);
+    }
+
+    /// Destroy the elements of a range.
+    static void destroyRange(T* first, T* last) noexcept
+    {
+        for (; first != last; ++first)
+        {
+            first->~T();
+        }
+    }
+
+    /// Deallocate the heap storage and go back to the inline storage.
+    /// \pre The elements must have been destroyed or moved out.
+    void releaseHeap() noexcept
+    {
+        if (!isInline())
+        {
+            std::allocator<T>().deallocate(m_data, m_capacity);
+            m_data = inlineData();
+            m_capacity = N;
+        }
+    }
+
+    /// Take the elements of another small vector and leave it empty.
+    /// \pre This small vector must be empty and use the inline storage.
+    void takeFrom(SmallVector& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (!other.isInline())
+        {
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_capacity = other.m_capacity;
+            other.m_data = other.inlineData();
+            other.m_size = 0;
+            other.m_capacity = N;
+            return;
+        }
+
+        for (; m_size < other.m_size; m_size++)
+        {
+            ::new (static_cast<void*>(m_data + m_size)) T(std::move(other.m_data[m_size]));
+        }
+        other.clear();
+    }
+
+    /// Append copies of the elements of a forward range.
+    template <typename ForwardIt>
+    void appendAll(ForwardIt first, ForwardIt last)
+    {
+        reserve(static_cast<size_type>(std::distance(first, last)));
+        for (; first != last; ++first)
+        {
+            emplace_back(*first);
+        }
+    }
+
+    /// Move the elements to a new heap storage with the given capacity.
+    void reallocate(size_type capacity)
+    {
+        T* storage = std::allocator<T>().allocate(capacity);
+
+        try
+        {
+            moveElementsTo(storage, capacity);
+        }
+        catch (...)
+        {
+            std::allocator<T>().deallocate(storage, capacity);
+            throw;
+        }
+    }
+
+    /// Construct a new element at the end of a larger heap storage, then move the existing elements there.
+    /// The new element is constructed first, since the arguments may refer to the existing elements.
+    template <typename... Args>
+    T& emplaceBackGrowing(Args&&... args)
+    {
+        const size_type capacity = std::max<size_type>(2 * m_capacity, m_size + 1);
+        T* storage = std::allocator<T>().allocate(capacity);
+
+        try
+        {
+            ::new (static_cast<void*>(storage + m_size)) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            std::allocator<T>().deallocate(storage, capacity);
+            throw;
+        }
+
+        try
+        {
+            moveElementsTo(storage, capacity);
+        }
+        catch (...)
+        {
+            storage[m_size].~T();
+            std::allocator<T>().deallocate(storage, capacity);
+            throw;
+        }
+        return m_data[m_size++];
+    }
+
+    /// Move the elements to an allocated heap storage and release the old storage.
+    /// If moving throws, the moved elements are destroyed and the elements stay where they were, the caller deallocates the storage.
+    void moveElementsTo(T* storage, size_type capacity)
+    {
+        size_type moved = 0;
+        try
+        {
+            for (; moved < m_size; moved++)
+            {
+                ::new (static_cast<void*>(storage + moved)) T(std::move_if_noexcept(m_data[moved]));
+            }
+        }
+        catch (...)
+        {
+            destroyRange(storage, storage + moved);
+            throw;
+        }
+
+        destroyRange(m_data, m_data + m_size);
+        releaseHeap();
+        m_data = storage;
+        m_capacity = capacity;
+    }
+
+    /// Pointing to the inline storage or to the heap storage.
+    T* m_data;
+
+    /// Amount of elements.
+    size_type m_size = 0;
+
+    /// Amount of elements that fit in the storage in use.
+    size_type m_capacity = N;
+
+    /// Storage for the first N elements.
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type m_inline[N];
+};
+
+template <typename T, std::size_t N>
+constexpr std::size_t SmallVector<T, N>::inlineCapacity;
+
+#endif
@@ -0,0 +1,841 @@
+#ifndef UNROLLED_LINKED_LIST_HPP
+#define UNROLLED_LINKED_LIST_HPP
+
+#include "simd_search.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/// The default amount of elements in one node of UnrolledLinkedList.
+/// The elements and the node header fill two cache lines, with at least four elements per node.
+/// \tparam T The type of the elements.
+template <typename T>
+struct UnrolledLinkedListCapacity
+    : std::integral_constant<std::size_t, ((128 - 3 * sizeof(void*)) / sizeof(T) > 4 ? (128 - 3 * sizeof(void*)) / sizeof(T) : 4)>
+{
+};
+
+/// This doubly linked list stores up to K elements contiguously in every node, so traversing it touches
+/// one node per K elements instead of one node per element. The order of the elements is kept by every operation.
+/// Every node holds at least one element, a node is split when inserting into it while full,
+/// and merged with the next node when erasing leaves room for both in one node.
+/// \tparam T The type of elements stored in the list.
+/// \tparam K The maximum amount of elements in one node, chosen from the size of T by default.
+/// \tparam Allocator The type of allocator used for the elements, rebound to allocate the nodes.
+template <typename T, std::size_t K = UnrolledLinkedListCapacity<T>::value, typename Allocator = std::allocator<T>>
+class UnrolledLinkedList
+{
+    static_assert(K >= 2, "UnrolledLinkedList needs room for at least two elements per node.");
+
+    /// A node holding up to K elements.
+    struct Node
+    {
+        /// The elements of the node.
+        /// \return Pointer to the first element.
+        T* data() noexcept
+        {
+            return reinterpret_cast<T*>(m_storage);
+        }
+
+        /// The elements of the node in const context.
+        /// \return Pointer to the first element.
+        const T* data() const noexcept
+        {
+            return reinterpret_cast<const T*>(m_storage);
+        }
+
+        /// Pointing towards the previous node.
+        Node* m_prev = nullptr;
+
+        /// Pointing towards the next node.
+        Node* m_next = nullptr;
+
+        /// The amount of constructed elements at the beginning of the storage.
+        std::size_t m_count = 0;
+
+        /// Uninitialized storage for the elements.
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type m_storage[K];
+    };
+
+    /// Bidirectional iterator over the elements.
+    /// An iterator is a node and a position in it, the end iterator has no node and finds the last node through the list.
+    /// \tparam IsConst Whether the elements are accessed as const.
+    template <bool IsConst>
+    class BasicIterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = typename std::conditional<IsConst, const T*, T*>::type;
+        using reference = typename std::conditional<IsConst, const T&, T&>::type;
+
+        /// Default constructor.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator() noexcept = default;
+
+        /// Conversion from an iterator to a constant iterator.
+        /// \param other The non-constant iterator.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        template <bool OtherConst, typename = typename std::enable_if<IsConst && !OtherConst>::type>
+        BasicIterator(const BasicIterator<OtherConst>& other) noexcept
+            : m_node(other.m_node), m_index(other.m_index), m_list(other.m_list)
+        {
+        }
+
+        /// Dereference operator.
+        /// \return Reference to the current element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        reference operator*() const noexcept
+        {
+            return m_node->data()[m_index];
+        }
+
+        /// Arrow operator.
+        /// \return Pointer to the current element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        pointer operator->() const noexcept
+        {
+            return m_node->data() + m_index;
+        }
+
+        /// Pre-increment operator.
+        /// \return Reference to the iterator after moving to the next element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator& operator++() noexcept
+        {
+            if (++m_index == m_node->m_count)
+            {
+                m_node = m_node->m_next;
+                m_index = 0;
+            }
+            return *this;
+        }
+
+        /// Post-increment operator.
+        /// \return Copy of the iterator before moving to the next element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator operator++(int) noexcept
+        {
+            BasicIterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        /// Pre-decrement operator.
+        /// \return Reference to the iterator after moving to the previous element.
+        /// \pre The iterator does not point to the first element.
+        /// \post Moves the iterator to the previous element, or from the end to the last element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator& operator--() noexcept
+        {
+            if (m_index > 0)
+            {
+                --m_index;
+                return *this;
+            }
+
+            m_node = m_node ? m_node->m_prev : m_list->m_tail;
+            m_index = m_node->m_count - 1;
+            return *this;
+        }
+
+        /// Post-decrement operator.
+        /// \return Copy of the iterator before moving to the previous element.
+        /// \pre The iterator does not point to the first element.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        BasicIterator operator--(int) noexcept
+        {
+            BasicIterator next = *this;
+            --(*this);
+            return next;
+        }
+
+        /// Equality operator.
+        /// \param other The iterator to compare with.
+        /// \return True if both iterators point to the same element, or both are end iterators.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        bool operator==(const BasicIterator& other) const noexcept
+        {
+            return m_node == other.m_node && m_index == other.m_index;
+        }
+
+        /// Inequality operator.
+        /// \param other The iterator to compare with.
+        /// \return True if the iterators point to different elements.
+        /// \exception noexcept No exceptions are thrown by this operation.
+        bool operator!=(const BasicIterator& other) const noexcept
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class UnrolledLinkedList;
+
+        template <bool>
+        friend class BasicIterator;
+
+        /// Constructor used by the list.
+        /// \param node The node of the element, nullptr for the end iterator.
+        /// \param index The position of the element in the node.
+        /// \param list The list of the element, used to step back from the end iterator.
+        BasicIterator(Node* node, std::size_t index, const UnrolledLinkedList* list) noexcept
+            : m_node(node), m_index(index), m_list(list)
+        {
+        }
+
+        /// The node of the current element.
+        Node* m_node = nullptr;
+
+        /// The position of the current element in the node.
+        std::size_t m_index = 0;
+
+        /// The list being traversed.
+        const UnrolledLinkedList* m_list = nullptr;
+    };
+
+    /// The allocator type for the nodes.
+    using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+
+    /// The allocator traits used for the nodes and for constructing and destroying the elements.
+    using AllocatorTraits = std::allocator_traits<NodeAllocator>;
+
+public:
+    /// The type of items stored in the list.
+    using value_type = T;
+
+    /// The type of the allocator.
+    using allocator_type = Allocator;
+
+    /// A bidirectional iterator for traversing elements in the list.
+    using iterator = BasicIterator<false>;
+
+    /// A constant bidirectional iterator for traversing elements in the list.
+    using const_iterator = BasicIterator<true>;
+
+    /// A bidirectional iterator for traversing elements from the last one to the first one.
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    /// A constant bidirectional iterator for traversing elements from the last one to the first one.
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// The maximum amount of elements in one node.
+    static constexpr std::size_t nodeCapacity = K;
+
+    /// Default constructor.
+    /// \post Constructs an empty list.
+    UnrolledLinkedList() = default;
+
+    /// Destructor.
+    /// \post Destroys all elements and deallocates all nodes.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    ~UnrolledLinkedList() noexcept
+    {
+        clear();
+    }
+
+    /// Initializer list constructor.
+    /// \param list An initializer list containing values to initialize the list with.
+    /// \post Constructs a list with the elements of the initializer list in the same order.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the elements.
+    UnrolledLinkedList(std::initializer_list<value_type> list)
+    {
+        appendAll(list.begin(), list.end());
+    }
+
+    /// Copy constructor.
+    /// \param other The list to be copied from.
+    /// \post Constructs a list with copies of the elements of the other list in the same order.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the elements.
+    UnrolledLinkedList(const UnrolledLinkedList& other)
+        : m_allocator(AllocatorTraits::select_on_container_copy_construction(other.m_allocator))
+    {
+        appendAll(other.cbegin(), other.cend());
+    }
+
+    /// Move constructor.
+    /// \param other The list to be moved from, left empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+        : m_head(other.m_head), m_tail(other.m_tail), m_count(other.m_count), m_allocator(other.m_allocator)
+    {
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
+        other.m_count = 0;
+    }
+
+    /// Copy assignment operator.
+    /// \param other The list to be assigned from.
+    /// \return A reference to this list.
+    /// \post The elements of this list are replaced with copies of the elements of the other list.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the elements.
+    ///            This list is left unchanged.
+    UnrolledLinkedList& operator=(const UnrolledLinkedList& other)
+    {
+        if (this != &other)
+        {
+            UnrolledLinkedList copy(other);
+            swap(copy);
+        }
+        return *this;
+    }
+
+    /// Move assignment operator.
+    /// \param other The list to be moved from, left empty.
+    /// \return A reference to this list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            swap(other);
+        }
+        return *this;
+    }
+
+    /// Get an iterator to the first element.
+    /// \return An iterator to the first element, or end() if the list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator begin() noexcept
+    {
+        return iterator(m_head, 0, this);
+    }
+
+    /// Get an iterator past the last element.
+    /// \return An iterator that acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    iterator end() noexcept
+    {
+        return iterator(nullptr, 0, this);
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first element, or end() if the list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator begin() const noexcept
+    {
+        return cbegin();
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator that acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator end() const noexcept
+    {
+        return cend();
+    }
+
+    /// Get a constant iterator to the first element.
+    /// \return A constant iterator to the first element, or cend() if the list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(m_head, 0, this);
+    }
+
+    /// Get a constant iterator past the last element.
+    /// \return A constant iterator that acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(nullptr, 0, this);
+    }
+
+    /// Get a reverse iterator to the last element.
+    /// \return A reverse iterator to the last element, or rend() if the list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+
+    /// Get a reverse iterator before the first element.
+    /// \return A reverse iterator that acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+
+    /// Get a constant reverse iterator to the last element.
+    /// \return A constant reverse iterator to the last element, or rend() if the list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return crbegin();
+    }
+
+    /// Get a constant reverse iterator before the first element.
+    /// \return A constant reverse iterator that acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_reverse_iterator rend() const noexcept
+    {
+        return crend();
+    }
+
+    /// Get a constant reverse iterator to the last element.
+    /// \return A constant reverse iterator to the last element, or crend() if the list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_reverse_iterator crbegin() const noexcept
+    {
+        return const_reverse_iterator(cend());
+    }
+
+    /// Get a constant reverse iterator before the first element.
+    /// \return A constant reverse iterator that acts as a sentinel and should not be dereferenced.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const_reverse_iterator crend() const noexcept
+    {
+        return const_reverse_iterator(cbegin());
+    }
+
+    /// Destroy all elements and deallocate all nodes.
+    /// \post The list is empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void clear() noexcept
+    {
+        while (m_head)
+        {
+            Node* next = m_head->m_next;
+            destroyElements(m_head, 0);
+            destroyNode(m_head);
+            m_head = next;
+        }
+        m_tail = nullptr;
+        m_count = 0;
+    }
+
+    /// Insert a new element with the given value at the end of the list.
+    /// \param value The value of the element to be inserted.
+    /// \return An iterator that points to the newly inserted element.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the copy constructor of the element.
+    ///            The list is left unchanged.
+    iterator insert(const T& value)
+    {
+        return emplace(value);
+    }
+
+    /// Insert a new element at the end of the list by moving the value.
+    /// \param value The value to be moved into the list.
+    /// \return An iterator that points to the newly inserted element.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the move constructor of the element.
+    ///            The list is left unchanged.
+    iterator insert(T&& value)
+    {
+        return emplace(std::move(value));
+    }
+
+    /// Construct a new element in place at the end of the list.
+    /// \param args The arguments forwarded to the constructor of the element.
+    /// \tparam Args The types of the constructor arguments.
+    /// \return An iterator that points to the newly inserted element.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the constructor of the element.
+    ///            The list is left unchanged.
+    /// \par Time complexity:
+    /// - O(1).
+    template <typename... Args>
+    iterator emplace(Args&&... args)
+    {
+        if (m_tail && m_tail->m_count < K)
+        {
+            AllocatorTraits::construct(m_allocator, m_tail->data() + m_tail->m_count, std::forward<Args>(args)...);
+        }
+        else
+        {
+            // The new node is linked only after its element is constructed, so no node is ever empty.
+            Node* node = createNode();
+            try
+            {
+                AllocatorTraits::construct(m_allocator, node->data(), std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                destroyNode(node);
+                throw;
+            }
+            linkAfter(m_tail, node);
+        }
+
+        ++m_count;
+        return iterator(m_tail, m_tail->m_count++, this);
+    }
+
+    /// Insert a new element with the given value in front of the position.
+    /// \param pos An iterator pointing to the position where the element is inserted, end() appends the element.
+    /// \param value The value of the element to be inserted.
+    /// \return An iterator that points to the newly inserted element.
+    /// \pre The iterator `pos` must be a valid iterator within the list.
+    /// \post Iterators to the elements of the node of `pos` are invalidated.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the constructors of the elements.
+    /// \par Time complexity:
+    /// - O(K).
+    iterator insert(iterator pos, const T& value)
+    {
+        return pos.m_node ? emplaceAt(pos.m_node, pos.m_index, value) : emplace(value);
+    }
+
+    /// Insert a new element in front of the position by moving the value.
+    /// \param pos An iterator pointing to the position where the element is inserted, end() appends the element.
+    /// \param value The value to be moved into the list.
+    /// \return An iterator that points to the newly inserted element.
+    /// \pre The iterator `pos` must be a valid iterator within the list.
+    /// \post Iterators to the elements of the node of `pos` are invalidated.
+    /// \exception May throw std::bad_alloc if memory allocation fails, or any exception thrown by the constructors of the elements.
+    /// \par Time complexity:
+    /// - O(K).
+    iterator insert(iterator pos, T&& value)
+    {
+        return pos.m_node ? emplaceAt(pos.m_node, pos.m_index, std::move(value)) : emplace(std::move(value));
+    }
+
+    /// Remove the first occurrence of the specified value from the list.
+    /// \param value The value of the element to be removed.
+    /// \return An iterator that points to the element following the removed element, or end() if no element was removed.
+    /// \exception Any exception thrown by the comparison or the move assignment of the elements.
+    iterator erase(const T& value)
+    {
+        iterator found = find(value);
+        return found == end() ? found : erase(found);
+    }
+
+    /// Remove the element at the specified position, keeping the order of the other elements.
+    /// \param pos An iterator pointing to the element to be removed.
+    /// \return An iterator that points to the element following the removed element, or end() if the last element was removed.
+    /// \pre The provided iterator must be valid and dereferenceable.
+    /// \post Iterators to the elements of the node of `pos` and of the node following it are invalidated.
+    /// \exception Any exception thrown by the move assignment of the elements.
+    /// \par Time complexity:
+    /// - O(K).
+    iterator erase(iterator pos)
+    {
+        Node* node = pos.m_node;
+        const std::size_t index = pos.m_index;
+        T* data = node->data();
+
+        std::move(data + index + 1, data + node->m_count, data + index);
+        AllocatorTraits::destroy(m_allocator, data + node->m_count - 1);
+        --node->m_count;
+        --m_count;
+
+        if (node->m_count == 0)
+        {
+            Node* next = node->m_next;
+            unlink(node);
+            destroyNode(node);
+            return iterator(next, 0, this);
+        }
+
+        // The elements of the next node move in, so the element after the removed one stays at `index`.
+        if (node->m_next && node->m_count + node->m_next->m_count <= K)
+        {
+            mergeNext(node);
+        }
+
+        if (index < node->m_count)
+        {
+            return iterator(node, index, this);
+        }
+        return iterator(node->m_next, 0, this);
+    }
+
+    /// Remove the elements in the range [first, last) from the list.
+    /// \param first An iterator pointing to the first element of the range to be removed.
+    /// \param last An iterator pointing to the element just beyond the last element of the range to be removed.
+    /// \return An iterator that points to the element that followed the range.
+    /// \pre The range [first, last) must be a valid range within the list.
+    /// \exception Any exception thrown by the move assignment of the elements.
+    iterator erase(iterator first, iterator last)
+    {
+        // Erasing merges nodes, which invalidates `last`, so the range is erased by its length.
+        for (auto length = std::distance(first, last); length > 0; --length)
+        {
+            first = erase(first);
+        }
+        return first;
+    }
+
+    /// Remove the last element.
+    /// \pre The list must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    /// \par Time complexity:
+    /// - O(1).
+    void pop_back() noexcept
+    {
+        AllocatorTraits::destroy(m_allocator, m_tail->data() + m_tail->m_count - 1);
+        --m_count;
+
+        if (--m_tail->m_count == 0)
+        {
+            Node* node = m_tail;
+            unlink(node);
+            destroyNode(node);
+        }
+    }
+
+    /// Find the first occurrence of a value.
+    /// \param value The value to search for.
+    /// \return An iterator to the first occurrence of the value, or end() if the value is not found.
+    /// \exception Any exception thrown by the comparison of the elements.
+    /// \note The elements of each node are searched as a contiguous range, with packed compares for arithmetic types.
+    iterator find(const T& value)
+    {
+        for (Node* node = m_head; node; node = node->m_next)
+        {
+            const T* data = node->data();
+            const T* found = SimdSearch<T>::find(data, data + node->m_count, value);
+            if (found != data + node->m_count)
+            {
+                return iterator(node, static_cast<std::size_t>(found - data), this);
+            }
+        }
+        return end();
+    }
+
+    /// Find the first occurrence of a value in const context.
+    /// \param value The value to search for.
+    /// \return A constant iterator to the first occurrence of the value, or cend() if the value is not found.
+    /// \exception Any exception thrown by the comparison of the elements.
+    const_iterator find(const T& value) const
+    {
+        return const_cast<UnrolledLinkedList*>(this)->find(value);
+    }
+
+    /// Count the occurrences of a value.
+    /// \param value The value to count.
+    /// \return The amount of elements equal to `value`.
+    /// \exception Any exception thrown by the comparison of the elements.
+    /// \note The elements of each node are counted as a contiguous range, with packed compares for arithmetic types.
+    std::size_t count(const T& value) const
+    {
+        std::size_t matches = 0;
+        for (const Node* node = m_head; node; node = node->m_next)
+        {
+            matches += SimdSearch<T>::count(node->data(), node->data() + node->m_count, value);
+        }
+        return matches;
+    }
+
+    /// Returns a reference to the first element.
+    /// \return A reference to the first element.
+    /// \pre The list must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    T& front() noexcept
+    {
+        return m_head->data()[0];
+    }
+
+    /// Returns a constant reference to the first element.
+    /// \return A constant reference to the first element.
+    /// \pre The list must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& front() const noexcept
+    {
+        return m_head->data()[0];
+    }
+
+    /// Returns a reference to the last element.
+    /// \return A reference to the last element.
+    /// \pre The list must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    T& back() noexcept
+    {
+        return m_tail->data()[m_tail->m_count - 1];
+    }
+
+    /// Returns a constant reference to the last element.
+    /// \return A constant reference to the last element.
+    /// \pre The list must not be empty.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    const T& back() const noexcept
+    {
+        return m_tail->data()[m_tail->m_count - 1];
+    }
+
+    /// Returns the number of elements.
+    /// \return The number of elements in the list.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    std::size_t size() const noexcept
+    {
+        return m_count;
+    }
+
+    /// Checks whether the list is empty.
+    /// \return True if the list is empty, otherwise false.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    bool empty() const noexcept
+    {
+        return m_count == 0;
+    }
+
+    /// Returns a copy of the allocator of the list.
+    /// \return The allocator of the elements.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    Allocator get_allocator() const noexcept
+    {
+        return Allocator(m_allocator);
+    }
+
+    /// Swap the contents of this list with another list.
+    /// \param other The other list to swap with.
+    /// \exception noexcept No exceptions are thrown by this operation.
+    void swap(UnrolledLinkedList& other) noexcept
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_tail, other.m_tail);
+        std::swap(m_count, other.m_count);
+
+        using std::swap;
+        swap(m_allocator, other.m_allocator);
+    }
+
+private:
+    /// Append copies of the elements of a range, destroying the list if a copy throws.
+    template <typename InputIt>
+    void appendAll(InputIt first, InputIt last)
+    {
+        try
+        {
+            for (; first != last; ++first)
+            {
+                emplace(*first);
+            }
+        }
+        catch (...)
+        {
+            clear();
+            throw;
+        }
+    }
+
+    /// Construct an element in front of a position inside a node, splitting the node if it is full.
+    /// \return An iterator to the new element.
+    template <typename... Args>
+    iterator emplaceAt(Node* node, std::size_t index, Args&&... args)
+    {
+        // The element is constructed first, so the node is not modified if its constructor throws.
+        T value(std::forward<Args>(args)...);
+
+        if (node->m_count == K)
+        {
+            splitNode(node);
+            if (index > node->m_count)
+            {
+                index -= node->m_count;
+                node = node->m_next;
+            }
+        }
+
+        T* data = node->data();
+        if (index == node->m_count)
+        {
+            AllocatorTraits::construct(m_allocator, data + index, std::move(value));
+        }
+        else
+        {
+            AllocatorTraits::construct(m_allocator, data + node->m_count, std::move(data[node->m_count - 1]));
+            std::move_backward(data + index, data + node->m_count - 1, data + node->m_count);
+            data[index] = std::move(value);
+        }
+
+        ++node->m_count;
+        ++m_count;
+        return iterator(node, index, this);
+    }
+
+    /// Move the upper half of a full node to a new node linked after it.
+    void splitNode(Node* node)
+    {
+        Node* upper = createNode();
+        const std::size_t half = K / 2;
+        T* data = node->data();
+
+        for (std::size_t i = half; i < K; i++)
+        {
+            AllocatorTraits::construct(m_allocator, upper->data() + upper->m_count, std::move(data[i]));
+            ++upper->m_count;
+        }
+        destroyElements(node, half);
+        linkAfter(node, upper);
+    }
+
+    /// Move the elements of the next node to the end of a node and remove the next node.
+    void mergeNext(Node* node)
+    {
+        Node* next = node->m_next;
+        T* data = next->data();
+
+        for (std::size_t i = 0; i < next->m_count; i++)
+        {
+            AllocatorTraits::construct(m_allocator, node->data() + node->m_count, std::move(data[i]));
+            ++node->m_count;
+        }
+        destroyElements(next, 0);
+        unlink(next);
+        destroyNode(next);
+    }
+
+    /// Destroy the elements of a node from a position to the end of the node.
+    void destroyElements(Node* node, std::size_t from) noexcept
+    {
+        for (std::size_t i = from; i < node->m_count; i++)
+        {
+            AllocatorTraits::destroy(m_allocator, node->data() + i);
+        }
+        node->m_count = from;
+    }
+
+    /// Allocate an empty node that is not linked to the list.
+    Node* createNode()
+    {
+        Node* node = AllocatorTraits::allocate(m_allocator, 1);
+        ::new (static_cast<void*>(node)) Node;
+        return node;
+    }
+
+    /// Deallocate a node whose elements are destroyed.
+    void destroyNode(Node* node) noexcept
+    {
+        node->~Node();
+        AllocatorTraits::deallocate(m_allocator, node, 1);
+    }
+
+    /// Link a node after another node, nullptr links it as the head.
+    void linkAfter(Node* previous, Node* node) noexcept
+    {
+        Node* next = previous ? previous->m_next : m_head;
+        node->m_prev = previous;
+        node->m_next = next;
+        (previous ? previous->m_next : m_head) = node;
+        (next ? next->m_prev : m_tail) = node;
+    }
+
+    /// Unlink a node from its neighbours, the head and the tail.
+    void unlink(Node* node) noexcept
+    {
+        (node->m_prev ? node->m_prev->m_next : m_head) = node->m_next;
+        (node->m_next ? node->m_next->m_prev : m_tail) = node->m_prev;
+    }
+
+    /// Pointing always to the first node.
+    Node* m_head = nullptr;
+
+    /// Pointing always to the last node.
+    Node* m_tail = nullptr;
+
+    /// Amount of elements in the list.
+    std::size_t m_count = 0;
+
+    /// Allocator for the nodes, also used for constructing and destroying the elements.
+    NodeAllocator m_allocator;
+};
+
+template <typename T, std::size_t K, typename Allocator>
+constexpr std::size_t UnrolledLinkedList<T, K, Allocator>::nodeCapacity;
+
+#endif
@@ -3,6 +3,8 @@
 #include <BagContainerAdaptor/bag_container_adaptor.hpp>
 
 #include <list>
+#include <memory>
+#include <string>
 
 // This is a special test for initializing BagContainerAdaptor with template argument of itself.
 
@@ -30,3 +32,148 @@ TEST(BagContainerAdaptor, InitializeBagContainerWithBagContainer)
         EXPECT_EQ(adapter.size(), 3);
     }
 }
+
+// Move-only types can be stored in the bag through the rvalue insert and emplace.
+TEST(BagContainerAdaptor, InsertMoveOnlyType)
+{
+    {
+        BagContainerAdaptor<std::unique_ptr<int>> adapter;
+
+        adapter.insert(std::unique_ptr<int>(new int(1)));
+        adapter.emplace(new int(2));
+
+        EXPECT_EQ(adapter.size(), 2);
+        EXPECT_EQ(*adapter.front(), 1);
+        EXPECT_EQ(*adapter.back(), 2);
+    }
+
+    {
+        BagContainerAdaptor<std::unique_ptr<int>, std::list<std::unique_ptr<int>>> adapter;
+
+        adapter.insert(std::unique_ptr<int>(new int(1)));
+        adapter.emplace(new int(2));
+
+        EXPECT_EQ(adapter.size(), 2);
+        EXPECT_EQ(*adapter.back(), 2);
+    }
+}
+
+// Emplace constructs the element from the constructor arguments directly inside the container.
+TEST(BagContainerAdaptor, EmplaceConstructsInPlace)
+{
+    BagContainerAdaptor<std::string, std::multiset<std::string>> adapter;
+
+    adapter.emplace(3, 'a');
+    adapter.emplace("bag");
+
+    EXPECT_EQ(adapter.size(), 2);
+    EXPECT_TRUE(adapter.find("aaa") != adapter.end());
+    EXPECT_TRUE(adapter.find("bag") != adapter.end());
+}
+
+// Reserving capacity up front keeps the vector from reallocating during the bulk load.
+TEST(BagContainerAdaptor, ReserveKeepsVectorStorage)
+{
+    BagContainerAdaptor<int> adapter;
+    adapter.reserve(1000);
+
+    adapter.insert(0);
+    const int* storage = &adapter.front();
+
+    std::vector<int> values(999, 1);
+    adapter.insert(values.begin(), values.end());
+
+    EXPECT_EQ(adapter.size(), 1000);
+    EXPECT_EQ(&adapter.front(), storage);
+}
+
+// std::forward_list has no size(), the adaptor keeps its own count through every insert and erase path.
+TEST(BagContainerAdaptor, ForwardListCachedSize)
+{
+    BagContainerAdaptor<int, std::forward_list<int>> adapter = std::forward_list<int>{1, 2, 3};
+    EXPECT_EQ(adapter.size(), 3);
+
+    adapter.insert(4);
+    adapter.emplace(2);
+    adapter.insert({2, 5});
+    EXPECT_EQ(adapter.size(), 7);
+
+    adapter.erase(2);
+    EXPECT_EQ(adapter.size(), 4);
+
+    adapter.erase(adapter.begin());
+    EXPECT_EQ(adapter.size(), 3);
+
+    adapter.erase(42);
+    EXPECT_EQ(adapter.size(), 3);
+
+    auto copy = adapter;
+    EXPECT_EQ(copy.size(), 3);
+
+    BagContainerAdaptor<int, std::forward_list<int>> other;
+    other.swap(copy);
+    EXPECT_EQ(copy.size(), 0);
+    EXPECT_EQ(other.size(), 3);
+
+    copy = std::move(other);
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_EQ(other.size(), 0);
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(copy.begin(), copy.end())), copy.size());
+}
+
+// Containers that provide size() and back() themselves do not carry any bookkeeping.
+TEST(BagContainerAdaptor, NoBookkeepingOverhead)
+{
+    EXPECT_EQ(sizeof(BagContainerAdaptor<int>), sizeof(std::vector<int>));
+    EXPECT_EQ(sizeof(BagContainerAdaptor<int, std::list<int>>), sizeof(std::list<int>));
+    EXPECT_EQ(sizeof(BagContainerAdaptor<int, std::multiset<int>>), sizeof(std::multiset<int>));
+}
+
+// Erasing by iterator from std::forward_list fills the hole with the first element instead of searching for the predecessor.
+TEST(BagContainerAdaptor, ForwardListEraseIteratorKeepsOtherValues)
+{
+    BagContainerAdaptor<int, std::forward_list<int>> adapter = std::forward_list<int>{1, 2, 3, 4, 5};
+
+    adapter.erase(adapter.find(3));
+    adapter.erase(adapter.find(5));
+    adapter.erase(adapter.find(1));
+
+    std::multiset<int> remaining(adapter.begin(), adapter.end());
+    EXPECT_EQ(remaining, (std::multiset<int>{2, 4}));
+    EXPECT_EQ(adapter.size(), 2);
+    EXPECT_EQ(adapter.back(), *std::next(adapter.begin()));
+}
+
+// The contiguous containers compact the survivors in one pass, every pattern of removed elements has to keep them intact.
+template <typename Container>
+static void compactEraseTest()
+{
+    for (unsigned pattern = 0; pattern < 256; pattern++)
+    {
+        BagContainerAdaptor<int, Container> adapter;
+        std::multiset<int> expected;
+
+        for (int i = 0; i < 8; i++)
+        {
+            const bool removed = (pattern >> i) & 1u;
+            adapter.insert(removed ? -1 : i);
+            if (!removed)
+            {
+                expected.insert(i);
+            }
+        }
+
+        EXPECT_EQ(adapter.erase(-1), 8 - expected.size());
+        EXPECT_EQ(std::multiset<int>(adapter.begin(), adapter.end()), expected);
+    }
+}
+
+TEST(BagContainerAdaptor, VectorCompactErase)
+{
+    compactEraseTest<std::vector<int>>();
+}
+
+TEST(BagContainerAdaptor, DequeCompactErase)
+{
+    compactEraseTest<std::deque<int>>();
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/container_traits.hpp>
+#include <BagContainerAdaptor/counted_multiset.hpp>
+#include <BagContainerAdaptor/indexed_vector.hpp>
+#include <BagContainerAdaptor/pool_allocator.hpp>
+#include <BagContainerAdaptor/small_vector.hpp>
+#include <BagContainerAdaptor/unrolled_linked_list.hpp>
+
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <memory>
+#include <set>
+#include <unordered_set>
+#include <vector>
+
+using PoolVector = std::vector<int, PoolAllocator<int>>;
+
+static_assert(IsContiguous<std::vector<int>>::value, "vector is contiguous");
+static_assert(IsContiguous<PoolVector>::value, "vector with another allocator is contiguous");
+static_assert(IsContiguous<SmallVector<int, 4>>::value, "small vector is contiguous");
+static_assert(!IsContiguous<std::deque<int>>::value, "deque is not contiguous");
+static_assert(IsRandomAccessSequence<std::deque<int>>::value, "deque supports swap and pop");
+static_assert(!IsRandomAccessSequence<std::list<int>>::value, "list has no random access");
+
+static_assert(HasRelease<PoolAllocator<int>>::value, "pool allocator releases its pool at once");
+static_assert(!HasRelease<std::allocator<int>>::value, "std::allocator frees block by block");
+
+static_assert(ContainerStrategy<std::vector<int>>::Insert::value == InsertStrategy::EmplaceBack, "");
+static_assert(ContainerStrategy<std::vector<int>>::Erase::value == EraseStrategy::SwapAndPop, "");
+static_assert(ContainerStrategy<std::vector<int>>::EraseValue::value == EraseValueStrategy::Contiguous, "");
+static_assert(ContainerStrategy<std::vector<int>>::Find::value == FindStrategy::Contiguous, "");
+static_assert(ContainerStrategy<std::vector<int>>::Reserve::value == ReserveStrategy::Member, "");
+
+static_assert(ContainerStrategy<PoolVector>::Find::value == FindStrategy::Contiguous, "");
+static_assert(ContainerStrategy<PoolVector>::Count::value == CountStrategy::Contiguous, "");
+
+static_assert(ContainerStrategy<std::deque<int>>::Erase::value == EraseStrategy::SwapAndPop, "");
+static_assert(ContainerStrategy<std::deque<int>>::EraseValue::value == EraseValueStrategy::Compact, "");
+static_assert(ContainerStrategy<std::deque<int>>::Find::value == FindStrategy::Linear, "");
+static_assert(ContainerStrategy<std::deque<int>>::Reserve::value == ReserveStrategy::None, "");
+
+static_assert(ContainerStrategy<std::list<int>>::Erase::value == EraseStrategy::Member, "");
+static_assert(ContainerStrategy<std::list<int>>::RangeInsert::value == RangeInsertStrategy::Positional, "");
+static_assert(ContainerStrategy<std::list<int>>::Back::value == BackStrategy::Member, "");
+
+static_assert(ContainerStrategy<std::forward_list<int>>::Front::value == FrontStrategy::Member, "");
+static_assert(ContainerStrategy<std::forward_list<int>>::Back::value == BackStrategy::Linear, "");
+static_assert(ContainerStrategy<std::forward_list<int>>::Size::value == SizeStrategy::Distance, "");
+
+static_assert(ContainerStrategy<std::multiset<int>>::Insert::value == InsertStrategy::EmplaceHint, "");
+static_assert(ContainerStrategy<std::multiset<int>>::EraseValue::value == EraseValueStrategy::EqualRange, "");
+static_assert(ContainerStrategy<std::multiset<int>>::Find::value == FindStrategy::Member, "");
+static_assert(ContainerStrategy<std::multiset<int>>::Count::value == CountStrategy::Member, "");
+static_assert(ContainerStrategy<std::multiset<int>>::Front::value == FrontStrategy::Begin, "");
+static_assert(ContainerStrategy<std::multiset<int>>::Back::value == BackStrategy::Reverse, "");
+
+static_assert(ContainerStrategy<std::set<int>>::Find::value == FindStrategy::Member, "");
+static_assert(ContainerStrategy<std::unordered_multiset<int>>::Find::value == FindStrategy::Member, "");
+static_assert(ContainerStrategy<std::unordered_multiset<int>>::Reserve::value == ReserveStrategy::Member, "");
+
+using PoolUnorderedMultiset = std::unordered_multiset<int, std::hash<int>, std::equal_to<int>, PoolAllocator<int>>;
+static_assert(ContainerStrategy<PoolUnorderedMultiset>::Find::value == FindStrategy::Member, "");
+static_assert(ContainerStrategy<PoolUnorderedMultiset>::EraseValue::value == EraseValueStrategy::EqualRange, "");
+static_assert(ContainerStrategy<PoolUnorderedMultiset>::Reserve::value == ReserveStrategy::Member, "");
+
+static_assert(ContainerStrategy<IndexedVector<int>>::Find::value == FindStrategy::Member, "");
+static_assert(ContainerStrategy<IndexedVector<int>>::Count::value == CountStrategy::Member, "");
+static_assert(ContainerStrategy<UnrolledLinkedList<int>>::RangeInsert::value == RangeInsertStrategy::Loop, "");
+static_assert(ContainerStrategy<SmallVector<int, 4>>::Find::value == FindStrategy::Contiguous, "");
+static_assert(ContainerStrategy<CountedMultiset<int>>::Count::value == CountStrategy::Member, "");
+static_assert(ContainerStrategy<CountedMultiset<int>>::EraseIf::value == EraseIfStrategy::Member, "");
+
+// The bag overloads of std::unordered_multiset and std::forward_list keep their bookkeeping with any allocator.
+TEST(ContainerTraits, BookkeepingOverloadsMatchCustomAllocators)
+{
+    BagContainerAdaptor<int, PoolUnorderedMultiset> unordered;
+    BagContainerAdaptor<int, std::forward_list<int, PoolAllocator<int>>> forward;
+
+    for (int i = 0; i < 100; i++)
+    {
+        unordered.insert(i);
+        forward.insert(i);
+    }
+
+    EXPECT_EQ(unordered.back(), 0);
+    EXPECT_EQ(forward.back(), 0);
+    EXPECT_EQ(forward.size(), 100);
+
+    EXPECT_EQ(unordered.erase(0), 1);
+    EXPECT_EQ(forward.erase_if([](int value) { return value == 0; }), 1);
+    EXPECT_EQ(unordered.back(), unordered.front());
+    EXPECT_EQ(forward.back(), 1);
+    EXPECT_EQ(forward.size(), 99);
+}
+
+TEST(ContainerTraits, SetBagUsesMemberLookups)
+{
+    // A set keeps one copy of each value, which it is allowed to do under a bag with unique values.
+    BagContainerAdaptor<int, std::set<int>> adapter;
+    adapter.insert({5, 1, 3});
+
+    EXPECT_EQ(adapter.front(), 1);
+    EXPECT_EQ(adapter.back(), 5);
+    EXPECT_EQ(*adapter.find(3), 3);
+    EXPECT_EQ(adapter.count(3), 1);
+    EXPECT_EQ(adapter.erase(3), 1);
+    EXPECT_EQ(adapter.find(3), adapter.end());
+    EXPECT_EQ(adapter.erase_if([](int value) { return value > 2; }), 1);
+    EXPECT_EQ(adapter.size(), 1);
+}
+
+TEST(ContainerTraits, AllocatorAwareVectorBag)
+{
+    BagContainerAdaptor<int, PoolVector> adapter;
+
+    for (int i = 0; i < 100; i++)
+    {
+        adapter.insert(i % 10);
+    }
+
+    EXPECT_EQ(adapter.count(7), 10);
+    EXPECT_EQ(*adapter.find(9), 9);
+    adapter.erase(adapter.find(0));
+    EXPECT_EQ(adapter.erase(1), 10);
+    EXPECT_EQ(adapter.erase_if([](int value) { return value < 3; }), 19);
+    EXPECT_EQ(adapter.size(), 70);
+    EXPECT_EQ(adapter.find(2), adapter.end());
+}
@@ -0,0 +1,228 @@
+#include <gtest/gtest.h>
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/counted_multiset.hpp>
+
+#include "random_operations.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+TEST(CountedMultiset, StoresEachValueOnce)
+{
+    CountedMultiset<std::string> counted;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        counted.insert(i % 3 == 0 ? "fizz" : "buzz");
+    }
+
+    EXPECT_EQ(counted.size(), 1000);
+    EXPECT_EQ(counted.distinct(), 2);
+    EXPECT_EQ(counted.count("fizz"), 334);
+    EXPECT_EQ(counted.count("buzz"), 666);
+    EXPECT_EQ(counted.count("bang"), 0);
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(counted.begin(), counted.end())), counted.size());
+}
+
+TEST(CountedMultiset, IterationRepeatsEachValue)
+{
+    CountedMultiset<int> counted{3, 1, 3, 2, 3, 1};
+
+    std::vector<int> values(counted.begin(), counted.end());
+    ASSERT_EQ(values.size(), 6);
+
+    // The copies of a value are visited one after another.
+    for (std::size_t i = 1; i < values.size(); i++)
+    {
+        if (values[i] != values[i - 1])
+        {
+            EXPECT_EQ(std::count(values.begin() + static_cast<std::ptrdiff_t>(i), values.end(), values[i - 1]), 0);
+        }
+    }
+
+    std::sort(values.begin(), values.end());
+    EXPECT_EQ(values, (std::vector<int>{1, 1, 2, 3, 3, 3}));
+}
+
+TEST(CountedMultiset, EraseIteratorRemovesOneCopy)
+{
+    CountedMultiset<int> counted{7, 7, 7};
+
+    auto it = counted.erase(counted.find(7));
+    EXPECT_EQ(counted.count(7), 2);
+    EXPECT_EQ(counted.size(), 2);
+    ASSERT_NE(it, counted.end());
+    EXPECT_EQ(*it, 7);
+
+    // Erasing the last copy removes the value.
+    it = counted.erase(std::next(counted.begin()));
+    EXPECT_EQ(it, counted.end());
+    it = counted.erase(counted.begin());
+    EXPECT_EQ(it, counted.end());
+    EXPECT_TRUE(counted.empty());
+    EXPECT_EQ(counted.distinct(), 0);
+    EXPECT_EQ(counted.find(7), counted.end());
+}
+
+TEST(CountedMultiset, EraseValueRemovesAllCopies)
+{
+    CountedMultiset<int> counted{1, 2, 2, 2, 3};
+
+    EXPECT_EQ(counted.erase(2), 3);
+    EXPECT_EQ(counted.erase(2), 0);
+    EXPECT_EQ(counted.size(), 2);
+    EXPECT_EQ(counted.erase_if([](int value) { return value > 2; }), 1);
+    EXPECT_EQ(std::vector<int>(counted.begin(), counted.end()), (std::vector<int>{1}));
+}
+
+TEST(CountedMultiset, IteratorPastDecrementedCountMovesOn)
+{
+    CountedMultiset<int> counted{7, 7};
+
+    // The second copy is stale after erasing the first one, but advancing it must still reach the end.
+    auto second = std::next(counted.begin());
+    counted.erase(counted.begin());
+    EXPECT_EQ(++second, counted.end());
+}
+
+TEST(CountedMultiset, CountIfCallsPredicateOncePerDistinctValue)
+{
+    CountedMultiset<int> counted{1, 2, 2, 2, 3, 3};
+
+    int calls = 0;
+    EXPECT_EQ(counted.count_if([&calls](int value) { calls++; return value > 1; }), 5);
+    EXPECT_EQ(calls, 3);
+    EXPECT_EQ(counted.count_if([](int value) { return value > 3; }), 0);
+}
+
+TEST(CountedMultiset, BackFollowsInsertionsAndCopies)
+{
+    CountedMultiset<int> counted;
+    counted.insert(1);
+    counted.insert(2);
+    counted.insert(1);
+    EXPECT_EQ(counted.back(), 1);
+
+    // The copy has its own keys, back() must not point into the original.
+    CountedMultiset<int> copy(counted);
+    counted.clear();
+    EXPECT_EQ(copy.back(), 1);
+
+    copy.erase(1);
+    EXPECT_EQ(copy.back(), 2);
+
+    CountedMultiset<int> moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(moved.back(), 2);
+}
+
+// Random operations on a counted multiset, checking after each one that the counts of the distinct values add up.
+struct CountedMultisetBackend
+{
+    void insert(int value)
+    {
+        EXPECT_EQ(*counted.insert(value), value);
+    }
+
+    int eraseAt(std::size_t position)
+    {
+        auto it = std::next(counted.begin(), static_cast<std::ptrdiff_t>(position));
+        const int value = *it;
+        counted.erase(it);
+        return value;
+    }
+
+    std::size_t erase(int value)
+    {
+        return counted.erase(value);
+    }
+
+    std::size_t count(int value) const
+    {
+        return counted.count(value);
+    }
+
+    std::vector<int> values() const
+    {
+        return std::vector<int>(counted.begin(), counted.end());
+    }
+
+    void check(const std::multiset<int>& reference) const
+    {
+        ASSERT_EQ(counted.size(), reference.size());
+
+        std::size_t distinct = 0;
+        for (auto it = reference.begin(); it != reference.end(); it = reference.upper_bound(*it))
+        {
+            EXPECT_EQ(counted.count(*it), reference.count(*it));
+            distinct++;
+        }
+        EXPECT_EQ(counted.distinct(), distinct);
+
+        if (!counted.empty())
+        {
+            EXPECT_EQ(reference.count(counted.back()), counted.count(counted.back()));
+            EXPECT_NE(reference.count(counted.back()), 0);
+        }
+    }
+
+    CountedMultiset<int> counted;
+};
+
+TEST(CountedMultiset, RandomOperationsMatchMultiset)
+{
+    CountedMultisetBackend backend;
+    std::multiset<int> reference;
+    runRandomOperations(backend, reference, 17, 20);
+
+    // Every copy of a value is visited once, so the iteration length is the size.
+    EXPECT_EQ(static_cast<std::size_t>(std::distance(backend.counted.begin(), backend.counted.end())), reference.size());
+}
+
+TEST(CountedMultiset, BagOfDuplicates)
+{
+    BagContainerAdaptor<int, CountedMultiset<int>> adapter;
+
+    for (int i = 0; i < 10000; i++)
+    {
+        adapter.insert(i % 4);
+    }
+
+    EXPECT_EQ(adapter.size(), 10000);
+    EXPECT_EQ(adapter.count(2), 2500);
+
+    adapter.erase(adapter.find(0));
+    EXPECT_EQ(adapter.count(0), 2499);
+    EXPECT_EQ(adapter.erase(1), 2500);
+    EXPECT_EQ(adapter.erase_if([](int value) { return value == 3; }), 2500);
+    EXPECT_EQ(adapter.size(), 4999);
+    EXPECT_EQ(adapter.count_if([](int value) { return value == 2; }), 2500);
+    EXPECT_TRUE(adapter.find(adapter.back()) != adapter.end());
+}
+
+// Hashes every value to a few buckets, a counted multiset with it must still take the counted paths of the bag.
+struct ModuloHash
+{
+    std::size_t operator()(int value) const noexcept
+    {
+        return static_cast<std::size_t>(value % 3);
+    }
+};
+
+TEST(CountedMultiset, BagWithCustomHashCountsPerDistinctValue)
+{
+    const std::vector<int> values{1, 1, 1, 2, 2, 3, 4, 4, 4, 4};
+    BagContainerAdaptor<int, CountedMultiset<int, ModuloHash>> adapter;
+    adapter.insert(values.begin(), values.end());
+
+    EXPECT_EQ(adapter.size(), 10);
+    EXPECT_EQ(adapter.count(4), 4);
+
+    int calls = 0;
+    EXPECT_EQ(adapter.count_if([&calls](int value) { calls++; return value % 2 == 0; }), 6);
+    EXPECT_EQ(calls, 4);
+}
@@ -2,6 +2,7 @@
 
 #include <BagContainerAdaptor/bag_container_adaptor.hpp>
 #include <BagContainerAdaptor/linked_list.hpp>
+#include <BagContainerAdaptor/pool_allocator.hpp>
 
 // Testing front() and back() member functions for types in bag container adaptor that
 // have normal order for items in the container.
@@ -32,7 +33,7 @@ protected:
     }
 };
 
-// Note that we are missing std::unordered_multiset.
+// std::forward_list and std::unordered_multiset are tested in reversed order below.
 using FrontAndBackContainerTypes = ::testing::Types<
     std::list<int>,
     std::vector<int>,
@@ -124,3 +125,151 @@ TYPED_TEST(FrontAndBackTestReversed, backTest)
 {
     this->backTest();
 }
+
+// std::unordered_multiset reorders elements on rehash, so back() returns a designated element instead of
+// the last one in iteration order. The designation only changes when the element is erased.
+TEST(FrontAndBackUnordered, backIsStableAcrossRehash)
+{
+    BagContainerAdaptor<int, std::unordered_multiset<int>> adaptor;
+
+    adaptor.insert(1);
+    const int* designated = &adaptor.back();
+
+    for (int i = 2; i < 1000; i++)
+    {
+        adaptor.insert(i);
+    }
+
+    EXPECT_EQ(1, adaptor.back());
+    EXPECT_EQ(designated, &adaptor.back());
+    EXPECT_EQ(*adaptor.cbegin(), adaptor.front());
+}
+
+// Hashes every value to a few buckets, so iteration order differs from the default hash.
+struct ModuloHash
+{
+    std::size_t operator()(int value) const noexcept
+    {
+        return static_cast<std::size_t>(value % 7);
+    }
+};
+
+TEST(FrontAndBackUnordered, backIsDesignatedWithCustomHashAndAllocator)
+{
+    BagContainerAdaptor<int, std::unordered_multiset<int, ModuloHash, std::equal_to<int>, PoolAllocator<int>>> adaptor;
+
+    adaptor.insert(1);
+    const int* designated = &adaptor.back();
+
+    for (int i = 2; i < 200; i++)
+    {
+        adaptor.insert(i);
+    }
+
+    EXPECT_EQ(1, adaptor.back());
+    EXPECT_EQ(designated, &adaptor.back());
+
+    adaptor.erase(1);
+    EXPECT_EQ(adaptor.front(), adaptor.back());
+}
+
+TEST(FrontAndBackUnordered, backIsStableAcrossReserve)
+{
+    BagContainerAdaptor<int, std::unordered_multiset<int>> adaptor = std::unordered_multiset<int>{1, 2, 3};
+
+    const int designated = adaptor.back();
+    adaptor.reserve(4096);
+    EXPECT_EQ(designated, adaptor.back());
+}
+
+TEST(FrontAndBackUnordered, backMovesToFrontWhenErased)
+{
+    BagContainerAdaptor<int, std::unordered_multiset<int>> adaptor = std::unordered_multiset<int>{1, 2, 3};
+
+    const int designated = adaptor.back();
+    adaptor.erase(designated);
+    EXPECT_NE(designated, adaptor.back());
+    EXPECT_EQ(adaptor.front(), adaptor.back());
+
+    // Erasing another element keeps the designation.
+    adaptor.insert(designated);
+    const int kept = adaptor.back();
+    adaptor.erase(adaptor.find(designated));
+    EXPECT_EQ(kept, adaptor.back());
+
+    adaptor.erase(adaptor.find(kept));
+    EXPECT_EQ(adaptor.size(), 1);
+    EXPECT_EQ(adaptor.front(), adaptor.back());
+}
+
+// back() has to stay consistent with the contents of the bag through inserts and erases.
+template <typename Container>
+class BackConsistencyTest : public ::testing::Test
+{
+protected:
+    void consistencyTest()
+    {
+        BagContainerAdaptor<int, Container> adaptor;
+
+        for (int i = 0; i < 50; i++)
+        {
+            adaptor.insert(i % 7);
+            expectBackInBag(adaptor);
+        }
+
+        for (int value = 0; value < 6; value++)
+        {
+            adaptor.erase(value);
+            expectBackInBag(adaptor);
+        }
+
+        while (adaptor.size() > 1)
+        {
+            adaptor.erase(adaptor.find(adaptor.back()));
+            expectBackInBag(adaptor);
+        }
+
+        EXPECT_EQ(adaptor.front(), adaptor.back());
+
+        auto copy = adaptor;
+        copy.insert(3);
+        expectBackInBag(copy);
+    }
+
+private:
+    static void expectBackInBag(BagContainerAdaptor<int, Container>& adaptor)
+    {
+        if (adaptor.empty())
+        {
+            return;
+        }
+
+        EXPECT_TRUE(adaptor.find(adaptor.back()) != adaptor.end());
+
+        // Every container except std::unordered_multiset returns the last element in iteration order.
+        if (!std::is_same<Container, std::unordered_multiset<int>>::value)
+        {
+            auto last = adaptor.cbegin();
+            for (auto it = adaptor.cbegin(); it != adaptor.cend(); ++it)
+            {
+                last = it;
+            }
+            EXPECT_EQ(*last, adaptor.back());
+        }
+    }
+};
+
+using BackConsistencyContainerTypes = ::testing::Types<
+    std::list<int>,
+    std::vector<int>,
+    std::deque<int>,
+    std::forward_list<int>,
+    std::multiset<int>,
+    std::unordered_multiset<int>>;
+
+TYPED_TEST_SUITE(BackConsistencyTest, BackConsistencyContainerTypes);
+
+TYPED_TEST(BackConsistencyTest, consistencyTest)
+{
+    this->consistencyTest();
+}
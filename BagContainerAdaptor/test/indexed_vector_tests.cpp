@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/indexed_vector.hpp>
+
+#include "random_operations.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+// Check that the storage and the index of the indexed vector agree with the reference.
+template <typename T>
+void expectSameContents(const IndexedVector<T>& indexed, const std::multiset<T>& reference)
+{
+    ASSERT_EQ(indexed.size(), reference.size());
+    EXPECT_EQ(std::multiset<T>(indexed.begin(), indexed.end()), reference);
+
+    for (auto it = reference.begin(); it != reference.end(); it = reference.upper_bound(*it))
+    {
+        EXPECT_EQ(indexed.count(*it), reference.count(*it));
+
+        auto found = indexed.find(*it);
+        ASSERT_NE(found, indexed.end());
+        EXPECT_EQ(*found, *it);
+    }
+}
+
+TEST(IndexedVector, FindAndCountMissingValue)
+{
+    IndexedVector<int> indexed{1, 2, 2, 3};
+
+    EXPECT_EQ(indexed.find(4), indexed.end());
+    EXPECT_EQ(indexed.count(4), 0);
+    EXPECT_EQ(indexed.erase(4), 0);
+    EXPECT_EQ(indexed.size(), 4);
+}
+
+TEST(IndexedVector, EraseIteratorMovesLastElement)
+{
+    IndexedVector<std::string> indexed{"a", "b", "c", "d"};
+
+    auto it = indexed.erase(indexed.begin() + 1);
+
+    EXPECT_EQ(*it, "d");
+    EXPECT_EQ(indexed.back(), "c");
+    EXPECT_EQ(indexed.find("d"), it);
+    EXPECT_EQ(indexed.find("b"), indexed.end());
+}
+
+TEST(IndexedVector, EraseValueRemovesAllCopies)
+{
+    IndexedVector<int> indexed{5, 1, 5, 2, 5, 3, 5};
+
+    EXPECT_EQ(indexed.erase(5), 4);
+    expectSameContents(indexed, std::multiset<int>{1, 2, 3});
+}
+
+// Random operations on an indexed vector, checking after each one that the index agrees with the storage.
+struct IndexedVectorBackend
+{
+    void insert(int value)
+    {
+        EXPECT_EQ(*indexed.insert(value), value);
+    }
+
+    int eraseAt(std::size_t position)
+    {
+        auto it = indexed.begin() + static_cast<std::ptrdiff_t>(position);
+        const int value = *it;
+        indexed.erase(it);
+        return value;
+    }
+
+    std::size_t erase(int value)
+    {
+        return indexed.erase(value);
+    }
+
+    std::size_t count(int value) const
+    {
+        return indexed.count(value);
+    }
+
+    std::vector<int> values() const
+    {
+        return std::vector<int>(indexed.begin(), indexed.end());
+    }
+
+    void check(const std::multiset<int>& reference) const
+    {
+        expectSameContents(indexed, reference);
+    }
+
+    IndexedVector<int> indexed;
+};
+
+TEST(IndexedVector, RandomOperationsMatchMultiset)
+{
+    IndexedVectorBackend backend;
+    std::multiset<int> reference;
+    runRandomOperations(backend, reference, 42, 31);
+
+    // Erasing by predicate removes the slots from the index as well.
+    auto odd = [](int element) { return element % 2 == 1 && element > 15; };
+    std::size_t expected = 0;
+    for (auto it = reference.begin(); it != reference.end();)
+    {
+        it = odd(*it) ? (++expected, reference.erase(it)) : std::next(it);
+    }
+    EXPECT_EQ(backend.indexed.erase_if(odd), expected);
+    expectSameContents(backend.indexed, reference);
+}
+
+TEST(IndexedVector, BagEraseValueUsesIndex)
+{
+    BagContainerAdaptor<int, IndexedVector<int>> adapter;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        adapter.insert(i % 10);
+    }
+
+    EXPECT_EQ(adapter.count(3), 100);
+    EXPECT_EQ(adapter.erase(3), 100);
+    EXPECT_EQ(adapter.count(3), 0);
+    EXPECT_EQ(adapter.find(3), adapter.end());
+    EXPECT_EQ(adapter.size(), 900);
+    EXPECT_EQ(*adapter.find(7), 7);
+}
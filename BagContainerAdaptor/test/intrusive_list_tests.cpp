@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/intrusive_list.hpp>
+
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+// An element of an object pool that can be linked to one intrusive list or bag at a time.
+struct Particle : IntrusiveListHook
+{
+    explicit Particle(int id = 0)
+        : m_id(id)
+    {
+    }
+
+    bool operator==(const Particle& other) const
+    {
+        return m_id == other.m_id;
+    }
+
+    int m_id;
+};
+
+// Collect the ids of the linked particles in iteration order.
+template <typename Range>
+std::vector<int> ids(const Range& range)
+{
+    std::vector<int> result;
+    for (auto it = range.cbegin(); it != range.cend(); ++it)
+    {
+        result.push_back(it->m_id);
+    }
+    return result;
+}
+
+TEST(IntrusiveList, LinksElementsInPlace)
+{
+    std::vector<Particle> pool{Particle(1), Particle(2), Particle(3)};
+    IntrusiveList<Particle> list;
+
+    for (auto& particle : pool)
+    {
+        EXPECT_EQ(&*list.insert(particle), &particle);
+    }
+
+    EXPECT_EQ(list.size(), 3);
+    EXPECT_EQ(&list.front(), &pool[0]);
+    EXPECT_EQ(&list.back(), &pool[2]);
+    EXPECT_EQ(ids(list), (std::vector<int>{1, 2, 3}));
+    EXPECT_EQ((std::prev(list.end()))->m_id, 3);
+}
+
+TEST(IntrusiveList, EraseThroughReference)
+{
+    std::vector<Particle> pool{Particle(1), Particle(2), Particle(3), Particle(4)};
+    IntrusiveList<Particle> list;
+    for (auto& particle : pool)
+    {
+        list.insert(particle);
+    }
+
+    auto next = list.erase(pool[1]);
+    EXPECT_EQ(&*next, &pool[2]);
+    EXPECT_FALSE(pool[1].isLinked());
+    list.erase(pool[3]);
+    list.insert(list.begin(), pool[1]);
+
+    EXPECT_EQ(ids(list), (std::vector<int>{2, 1, 3}));
+    EXPECT_TRUE(pool[1].isLinked());
+    EXPECT_FALSE(pool[3].isLinked());
+}
+
+TEST(IntrusiveList, CopiedElementIsNotLinked)
+{
+    Particle particle(1);
+    IntrusiveList<Particle> list;
+    list.insert(particle);
+
+    Particle copy(particle);
+    EXPECT_FALSE(copy.isLinked());
+
+    copy = particle;
+    EXPECT_FALSE(copy.isLinked());
+    EXPECT_EQ(copy.m_id, 1);
+}
+
+TEST(IntrusiveList, MoveAndClearUnlinkElements)
+{
+    std::vector<Particle> pool{Particle(1), Particle(2)};
+    IntrusiveList<Particle> list;
+    list.insert(pool[0]);
+    list.insert(pool[1]);
+
+    IntrusiveList<Particle> moved(std::move(list));
+    EXPECT_TRUE(list.empty());
+    EXPECT_EQ(list.begin(), list.end());
+    EXPECT_EQ(ids(moved), (std::vector<int>{1, 2}));
+
+    moved.clear();
+    EXPECT_FALSE(pool[0].isLinked());
+    EXPECT_FALSE(pool[1].isLinked());
+
+    // The cleared elements can be linked again.
+    list.insert(pool[1]);
+    EXPECT_EQ(ids(list), (std::vector<int>{2}));
+}
+
+TEST(IntrusiveList, InsertAndEraseDoNotThrow)
+{
+    static_assert(noexcept(std::declval<IntrusiveList<Particle>&>().insert(std::declval<Particle&>())), "insert must not allocate");
+    static_assert(noexcept(std::declval<IntrusiveList<Particle>&>().erase(std::declval<Particle&>())), "erase must not allocate");
+    static_assert(noexcept(std::declval<BagContainerAdaptor<Particle, IntrusiveList<Particle>>&>().insert(std::declval<Particle&>())), "insert must not allocate");
+    static_assert(noexcept(std::declval<BagContainerAdaptor<Particle, IntrusiveList<Particle>>&>().unlink(std::declval<Particle&>())), "unlink must not allocate");
+    static_assert(!std::is_copy_constructible<BagContainerAdaptor<Particle, IntrusiveList<Particle>>>::value, "elements are in one bag at a time");
+}
+
+TEST(IntrusiveList, BagLinksPoolElements)
+{
+    std::vector<Particle> pool;
+    for (int i = 0; i < 10; i++)
+    {
+        pool.emplace_back(i % 5);
+    }
+
+    BagContainerAdaptor<Particle, IntrusiveList<Particle>> adapter;
+    adapter.insert(pool.begin(), pool.end());
+
+    EXPECT_EQ(adapter.size(), 10);
+    EXPECT_EQ(adapter.count(Particle(3)), 2);
+    EXPECT_EQ(&*adapter.find(Particle(4)), &pool[4]);
+
+    adapter.unlink(pool[4]);
+    EXPECT_EQ(&*adapter.find(Particle(4)), &pool[9]);
+    adapter.erase(adapter.find(Particle(4)));
+    EXPECT_EQ(adapter.find(Particle(4)), adapter.end());
+
+    // Erasing by value unlinks the equal elements, the given object does not have to be linked.
+    EXPECT_EQ(adapter.erase(Particle(0)), 2);
+    EXPECT_FALSE(pool[0].isLinked());
+    EXPECT_FALSE(pool[5].isLinked());
+    EXPECT_EQ(adapter.erase(Particle(0)), 0);
+
+    EXPECT_EQ(adapter.erase_if([](const Particle& particle) { return particle.m_id < 2; }), 2);
+    EXPECT_EQ(adapter.size(), 4);
+    EXPECT_EQ(adapter.count_if([](const Particle& particle) { return particle.isLinked(); }), 4);
+    EXPECT_EQ(&adapter.front(), &pool[2]);
+    EXPECT_EQ(&adapter.back(), &pool[8]);
+
+    BagContainerAdaptor<Particle, IntrusiveList<Particle>> other;
+    other.swap(adapter);
+    EXPECT_TRUE(adapter.empty());
+    EXPECT_EQ(ids(other), (std::vector<int>{2, 3, 2, 3}));
+}
+
+TEST(IntrusiveList, SpliceAndMergeRelinkElements)
+{
+    std::vector<Particle> pool{Particle(1), Particle(2), Particle(3), Particle(4)};
+
+    IntrusiveList<Particle> list;
+    list.insert(pool[0]);
+    list.insert(pool[3]);
+    IntrusiveList<Particle> other;
+    other.insert(pool[1]);
+    other.insert(pool[2]);
+
+    list.splice(std::next(list.cbegin()), other);
+    EXPECT_EQ(ids(list), (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_EQ(list.size(), 4);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(other.begin(), other.end());
+    EXPECT_EQ(std::prev(list.end())->m_id, 4);
+
+    BagContainerAdaptor<Particle, IntrusiveList<Particle>> bag(std::move(list));
+    BagContainerAdaptor<Particle, IntrusiveList<Particle>> empty;
+    empty.merge(std::move(bag));
+    EXPECT_EQ(ids(empty), (std::vector<int>{1, 2, 3, 4}));
+    EXPECT_TRUE(bag.empty());
+
+    // The elements can still be unlinked from the bag they were merged into.
+    empty.erase(empty.begin());
+    bag.insert(pool[0]);
+    EXPECT_EQ(ids(bag), (std::vector<int>{1}));
+    EXPECT_EQ(ids(empty), (std::vector<int>{2, 3, 4}));
+}
@@ -2,6 +2,14 @@
 
 #include <BagContainerAdaptor/bag_container_adaptor.hpp>
 #include <BagContainerAdaptor/linked_list.hpp>
+#include <BagContainerAdaptor/pool_allocator.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 template <typename IteratorType>
 class IteratorSTLTest : public ::testing::Test
@@ -221,13 +229,13 @@ TEST(TestIterators, ConversionConstIteratorToIterator)
 TEST(TestIterators, ConversionReverseIteratorToConstantReverseIterator)
 {
     LinkedList<int> list{1, 2, 3, 4, 5};
-    conversionTest<LinkedList<int>, LinkedList<int>::reverse_iterator, LinkedList<int>::const_reverse_iterator>(list, list.rend());
+    conversionTest<LinkedList<int>, LinkedList<int>::reverse_iterator, LinkedList<int>::const_reverse_iterator>(list, list.rbegin());
 }
 
 TEST(TestIterators, ConversionConstantReverseIteratorToReverseIterator)
 {
     LinkedList<int> list{1, 2, 3, 4, 5};
-    conversionTest<LinkedList<int>, LinkedList<int>::const_reverse_iterator, LinkedList<int>::reverse_iterator>(list, list.crend());
+    conversionTest<LinkedList<int>, LinkedList<int>::const_reverse_iterator, LinkedList<int>::reverse_iterator>(list, list.crbegin());
 }
 
 template <typename List, typename IteratorType>
@@ -275,13 +283,13 @@ TEST(IteratorTest, TestConstantIteratorIteration)
 TEST(IteratorTest, TestReverseIteratorIteration)
 {
     LinkedList<int> list = {5, 554, 222, 22, 2, 9};
-    IteratorTest<LinkedList<int>, LinkedList<int>::reverse_iterator>::iterationTest(list, list.rend(), list.rbegin());
+    IteratorTest<LinkedList<int>, LinkedList<int>::reverse_iterator>::iterationTest(list, list.rbegin(), list.rend());
 }
 
 TEST(IteratorTest, TestConstantReverseIteratorIteration)
 {
     LinkedList<int> list = {8, 54, 212, 82, 12, 29};
-    IteratorTest<LinkedList<int>, LinkedList<int>::const_reverse_iterator>::iterationTest(list, list.crend(), list.crbegin());
+    IteratorTest<LinkedList<int>, LinkedList<int>::const_reverse_iterator>::iterationTest(list, list.crbegin(), list.crend());
 }
 
 TEST(IteratorTest, TestNormalIteratorIncrement)
@@ -299,11 +307,428 @@ TEST(IteratorTest, TestConstantIteratorIncrement)
 TEST(IteratorTest, TestReverseIteratorIncrement)
 {
     LinkedList<int> list = {1, 2, 3, 4, 5};
-    IteratorTest<LinkedList<int>, LinkedList<int>::reverse_iterator>::incrementTest(list, list.rend());
+    IteratorTest<LinkedList<int>, LinkedList<int>::reverse_iterator>::incrementTest(list, list.rbegin());
 }
 
 TEST(IteratorTest, TestConstantReverseIteratorIncrement)
 {
     LinkedList<int> list = {1, 2, 3, 4, 5};
-    IteratorTest<LinkedList<int>, LinkedList<int>::const_reverse_iterator>::incrementTest(list, list.crend());
+    IteratorTest<LinkedList<int>, LinkedList<int>::const_reverse_iterator>::incrementTest(list, list.crbegin());
+}
+
+// Allocator that counts the nodes in use and the elements alive, so that leaks and double frees show up as non-zero counts.
+// LinkedList default constructs its allocator, so the counts of the running test are found through a global pointer.
+struct AllocationCounts
+{
+    long nodes = 0;
+    long elements = 0;
+};
+
+AllocationCounts* currentCounts = nullptr;
+
+template <typename Node>
+class CountingAllocator
+{
+public:
+    using value_type = Node;
+
+    CountingAllocator() noexcept
+        : m_counts(currentCounts)
+    {
+    }
+
+    template <typename U>
+    CountingAllocator(const CountingAllocator<U>& other) noexcept
+        : m_counts(other.counts())
+    {
+    }
+
+    Node* allocate(std::size_t n)
+    {
+        m_counts->nodes += static_cast<long>(n);
+        return std::allocator<Node>().allocate(n);
+    }
+
+    void deallocate(Node* pointer, std::size_t n) noexcept
+    {
+        m_counts->nodes -= static_cast<long>(n);
+        std::allocator<Node>().deallocate(pointer, n);
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* pointer, Args&&... args)
+    {
+        ::new (static_cast<void*>(pointer)) U(std::forward<Args>(args)...);
+        m_counts->elements++;
+    }
+
+    template <typename U>
+    void destroy(U* pointer) noexcept
+    {
+        pointer->~U();
+        m_counts->elements--;
+    }
+
+    AllocationCounts* counts() const noexcept
+    {
+        return m_counts;
+    }
+
+    friend bool operator==(const CountingAllocator& lhs, const CountingAllocator& rhs) noexcept
+    {
+        return lhs.m_counts == rhs.m_counts;
+    }
+
+    friend bool operator!=(const CountingAllocator& lhs, const CountingAllocator& rhs) noexcept
+    {
+        return lhs.m_counts != rhs.m_counts;
+    }
+
+private:
+    AllocationCounts* m_counts;
+};
+
+using CountedList = LinkedList<std::string, CountingAllocator<LinkedListNode<std::string>>>;
+
+TEST(LinkedListLifetime, EraseAndClearDestroyElements)
+{
+    AllocationCounts counts;
+    currentCounts = &counts;
+
+    {
+        CountedList list{"one", "two", "three", "four", "five", "six"};
+        EXPECT_EQ(counts.nodes, 6);
+        EXPECT_EQ(counts.elements, 6);
+
+        list.erase(list.begin());
+        list.erase(std::string("four"));
+        EXPECT_EQ(counts.elements, 4);
+
+        auto last = list.erase(std::next(list.begin()), list.end());
+        EXPECT_EQ(last, list.end());
+        EXPECT_EQ(list.size(), 1);
+        EXPECT_EQ(*list.begin(), "two");
+        EXPECT_EQ(counts.elements, 1);
+
+        list.insert("seven");
+        list.clear();
+        EXPECT_EQ(counts.nodes, 0);
+        EXPECT_EQ(counts.elements, 0);
+
+        list.insert("eight");
+    }
+
+    EXPECT_EQ(counts.nodes, 0);
+    EXPECT_EQ(counts.elements, 0);
+}
+
+TEST(LinkedListLifetime, CopyIsDeep)
+{
+    AllocationCounts counts;
+    currentCounts = &counts;
+
+    {
+        CountedList list{"one", "two", "three"};
+        CountedList copy(list);
+        EXPECT_EQ(counts.elements, 6);
+
+        list.erase(list.begin());
+        EXPECT_EQ(std::vector<std::string>(copy.begin(), copy.end()), (std::vector<std::string>{"one", "two", "three"}));
+
+        CountedList assigned{"four"};
+        assigned = copy;
+        EXPECT_EQ(std::vector<std::string>(assigned.begin(), assigned.end()), (std::vector<std::string>{"one", "two", "three"}));
+        EXPECT_EQ(counts.elements, 8);
+    }
+
+    EXPECT_EQ(counts.nodes, 0);
+    EXPECT_EQ(counts.elements, 0);
+}
+
+TEST(LinkedListLifetime, UnequalAllocatorsDoNotPropagate)
+{
+    // CountingAllocator does not declare the propagation traits, so it stays with its list.
+    AllocationCounts ownCounts;
+    AllocationCounts otherCounts;
+
+    {
+        currentCounts = &ownCounts;
+        CountedList list{"one"};
+        currentCounts = &otherCounts;
+        CountedList other{"two", "three"};
+
+        list = std::move(other);
+        EXPECT_EQ(list.get_allocator().counts(), &ownCounts);
+        EXPECT_EQ(std::vector<std::string>(list.begin(), list.end()), (std::vector<std::string>{"two", "three"}));
+        EXPECT_TRUE(other.empty());
+        EXPECT_EQ(ownCounts.nodes, 2);
+        EXPECT_EQ(ownCounts.elements, 2);
+        EXPECT_EQ(otherCounts.nodes, 0);
+
+        other.insert("four");
+        list = other;
+        EXPECT_EQ(list.get_allocator().counts(), &ownCounts);
+        EXPECT_EQ(std::vector<std::string>(list.begin(), list.end()), (std::vector<std::string>{"four"}));
+        EXPECT_EQ(ownCounts.nodes, 1);
+        EXPECT_EQ(otherCounts.nodes, 1);
+
+        CountedList same;
+        same.insert("five");
+        same = std::move(other);
+        EXPECT_EQ(same.get_allocator().counts(), &otherCounts);
+        EXPECT_EQ(otherCounts.nodes, 1);
+
+        CountedList swapped;
+        swapped.swap(same);
+        EXPECT_EQ(swapped.get_allocator().counts(), &otherCounts);
+        EXPECT_EQ(std::vector<std::string>(swapped.begin(), swapped.end()), (std::vector<std::string>{"four"}));
+    }
+
+    EXPECT_EQ(ownCounts.nodes, 0);
+    EXPECT_EQ(ownCounts.elements, 0);
+    EXPECT_EQ(otherCounts.nodes, 0);
+    EXPECT_EQ(otherCounts.elements, 0);
+}
+
+TEST(LinkedListLifetime, MoveInsertAndEmplace)
+{
+    AllocationCounts counts;
+    currentCounts = &counts;
+
+    {
+        CountedList list;
+        std::string moved(100, 'x');
+
+        list.insert(std::move(moved));
+        list.emplace(3, 'y');
+        list.insert(list.begin(), std::string("first"));
+        list.insert(std::next(list.begin()), std::string("second"));
+
+        EXPECT_EQ(std::vector<std::string>(list.begin(), list.end()),
+                  (std::vector<std::string>{"first", "second", std::string(100, 'x'), "yyy"}));
+        EXPECT_EQ(moved.size(), 0);
+
+        CountedList other(std::move(list));
+        EXPECT_EQ(other.size(), 4);
+        EXPECT_EQ(counts.elements, 4);
+    }
+
+    EXPECT_EQ(counts.nodes, 0);
+    EXPECT_EQ(counts.elements, 0);
+}
+
+TEST(LinkedListLifetime, EmplaceMoveOnlyType)
+{
+    LinkedList<std::unique_ptr<int>> list;
+
+    list.emplace(new int(1));
+    list.insert(std::unique_ptr<int>(new int(2)));
+    list.erase(list.begin());
+
+    EXPECT_EQ(list.size(), 1);
+    EXPECT_EQ(**list.begin(), 2);
+}
+
+TEST(LinkedListIterators, ReverseIterationVisitsElementsBackwards)
+{
+    LinkedList<int> list{1, 2, 3, 4};
+    const LinkedList<int>& constList = list;
+
+    EXPECT_EQ(std::vector<int>(list.rbegin(), list.rend()), (std::vector<int>{4, 3, 2, 1}));
+    EXPECT_EQ(std::vector<int>(constList.rbegin(), constList.rend()), (std::vector<int>{4, 3, 2, 1}));
+    EXPECT_EQ(std::vector<int>(constList.begin(), constList.end()), (std::vector<int>{1, 2, 3, 4}));
+
+    LinkedList<int> empty;
+    EXPECT_EQ(empty.rbegin(), empty.rend());
+}
+
+TEST(LinkedListIterators, TraitsDescribeElements)
+{
+    using List = LinkedList<std::string>;
+
+    EXPECT_TRUE((std::is_same<std::iterator_traits<List::iterator>::value_type, std::string>::value));
+    EXPECT_TRUE((std::is_same<std::iterator_traits<List::iterator>::reference, std::string&>::value));
+    EXPECT_TRUE((std::is_same<std::iterator_traits<List::const_iterator>::reference, const std::string&>::value));
+    EXPECT_TRUE((std::is_same<std::iterator_traits<List::const_reverse_iterator>::pointer, const std::string*>::value));
+
+    const List list{"a", "b"};
+    List::const_iterator it = list.find("b");
+    EXPECT_EQ(it->size(), 1);
+    EXPECT_EQ(list.find("c"), list.cend());
+}
+
+TEST(LinkedListBag, ConstantTimeOperations)
+{
+    BagContainerAdaptor<std::string, LinkedList<std::string>> adapter;
+
+    for (int i = 0; i < 100; i++)
+    {
+        adapter.insert(std::to_string(i % 10));
+    }
+
+    EXPECT_EQ(adapter.size(), 100);
+    EXPECT_EQ(adapter.front(), "0");
+    EXPECT_EQ(adapter.back(), "9");
+    EXPECT_EQ(adapter.count("3"), 10);
+
+    adapter.erase(adapter.find("3"));
+    EXPECT_EQ(adapter.count("3"), 9);
+    EXPECT_EQ(adapter.erase("4"), 10);
+    EXPECT_EQ(adapter.erase_if([](const std::string& value) { return value == "5"; }), 10);
+    EXPECT_EQ(adapter.size(), 79);
+    EXPECT_EQ(adapter.find("4"), adapter.end());
+}
+
+TEST(LinkedListBag, AllocatorOwnsNodes)
+{
+    AllocationCounts counts;
+    currentCounts = &counts;
+
+    {
+        BagContainerAdaptor<std::string, CountedList> adapter;
+        adapter.insert({"one", "two", "three"});
+        EXPECT_EQ(counts.nodes, 3);
+
+        adapter.erase(adapter.find("two"));
+        EXPECT_EQ(counts.nodes, 2);
+        EXPECT_EQ(counts.elements, 2);
+    }
+
+    EXPECT_EQ(counts.nodes, 0);
+    EXPECT_EQ(counts.elements, 0);
+
+    BagContainerAdaptor<int, LinkedList<int, PoolAllocator<LinkedListNode<int>>>> pooled;
+    for (int i = 0; i < 1000; i++)
+    {
+        pooled.insert(i);
+    }
+    EXPECT_EQ(pooled.erase_if([](int value) { return value % 2 == 0; }), 500);
+    EXPECT_EQ(pooled.size(), 500);
+}
+
+TEST(LinkedListIterators, BidirectionalAlgorithms)
+{
+    static_assert(std::is_same<std::iterator_traits<LinkedList<int>::iterator>::iterator_category, std::bidirectional_iterator_tag>::value,
+                  "LinkedList iterators are bidirectional");
+
+    LinkedList<int> list{1, 2, 3, 4, 5};
+
+    EXPECT_EQ(*std::prev(list.end()), 5);
+    EXPECT_EQ(*std::prev(list.cend(), 2), 4);
+    EXPECT_EQ(*std::prev(list.rend()), 1);
+    EXPECT_EQ(*std::prev(list.crend(), 2), 2);
+
+    auto it = std::prev(list.end());
+    EXPECT_EQ(*it--, 5);
+    EXPECT_EQ(*it, 4);
+    EXPECT_EQ(*--it, 3);
+
+    std::reverse(list.begin(), list.end());
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), (std::vector<int>{5, 4, 3, 2, 1}));
+    EXPECT_EQ(list.front(), 5);
+    EXPECT_EQ(list.back(), 1);
+}
+
+TEST(LinkedListSplice, RelinksWithoutAllocating)
+{
+    AllocationCounts counts;
+    currentCounts = &counts;
+
+    {
+        CountedList list{"a", "d"};
+        CountedList other{"b", "c"};
+        auto moved = other.begin();
+
+        list.splice(std::next(list.cbegin()), other);
+        EXPECT_EQ(counts.nodes, 4);
+        EXPECT_EQ(counts.elements, 4);
+        EXPECT_TRUE(other.empty());
+        EXPECT_EQ(list.size(), 4);
+        EXPECT_EQ(std::vector<std::string>(list.begin(), list.end()), (std::vector<std::string>{"a", "b", "c", "d"}));
+        EXPECT_EQ(std::vector<std::string>(list.rbegin(), list.rend()), (std::vector<std::string>{"d", "c", "b", "a"}));
+        EXPECT_EQ(*moved, "b");
+
+        // A single element moves to the other list and within a list.
+        other.splice(other.cend(), list, moved);
+        list.splice(list.cbegin(), list, std::prev(list.cend()));
+        EXPECT_EQ(std::vector<std::string>(list.begin(), list.end()), (std::vector<std::string>{"d", "a", "c"}));
+        EXPECT_EQ(list.back(), "c");
+        EXPECT_EQ(other.front(), "b");
+        EXPECT_EQ(other.size(), 1);
+
+        list.splice(list.cend(), CountedList{"e"});
+        EXPECT_EQ(list.back(), "e");
+        EXPECT_EQ(counts.elements, 5);
+    }
+
+    EXPECT_EQ(counts.nodes, 0);
+    EXPECT_EQ(counts.elements, 0);
+}
+
+TEST(LinkedListSplice, MergeSortedLists)
+{
+    struct Entry
+    {
+        int key;
+        char list;
+    };
+
+    LinkedList<Entry> list{{1, 'a'}, {3, 'a'}, {3, 'a'}, {8, 'a'}};
+    LinkedList<Entry> other{{0, 'b'}, {3, 'b'}, {9, 'b'}, {10, 'b'}};
+    const auto byKey = [](const Entry& lhs, const Entry& rhs) { return lhs.key < rhs.key; };
+
+    list.merge(other, byKey);
+    EXPECT_TRUE(other.empty());
+    ASSERT_EQ(list.size(), 8);
+
+    std::string order;
+    for (const Entry& entry : list)
+    {
+        order += std::to_string(entry.key) + entry.list;
+    }
+    EXPECT_EQ(order, "0b1a3a3a3b8a9b10b");
+    EXPECT_EQ(list.back().key, 10);
+    EXPECT_EQ(std::prev(list.end())->key, 10);
+
+    LinkedList<int> numbers{2, 4};
+    numbers.merge(LinkedList<int>{1, 3, 5});
+    EXPECT_EQ(std::vector<int>(numbers.begin(), numbers.end()), (std::vector<int>{1, 2, 3, 4, 5}));
+}
+
+TEST(LinkedListBag, MergeRelinksNodes)
+{
+    AllocationCounts counts;
+    currentCounts = &counts;
+
+    {
+        BagContainerAdaptor<std::string, CountedList> adapter;
+        adapter.insert({"one", "two"});
+        BagContainerAdaptor<std::string, CountedList> other;
+        other.insert({"three", "four"});
+        auto moved = other.find("four");
+
+        adapter.merge(std::move(other));
+        EXPECT_EQ(counts.nodes, 4);
+        EXPECT_EQ(counts.elements, 4);
+        EXPECT_EQ(adapter.size(), 4);
+        EXPECT_EQ(adapter.back(), "four");
+        EXPECT_TRUE(other.empty());
+
+        adapter.erase(moved);
+        EXPECT_EQ(adapter.back(), "three");
+    }
+
+    EXPECT_EQ(counts.nodes, 0);
+
+    // Every default constructed PoolAllocator has an arena of its own, so the elements are moved instead.
+    using PoolList = LinkedList<int, PoolAllocator<LinkedListNode<int>>>;
+    BagContainerAdaptor<int, PoolList> pooled;
+    pooled.insert({1, 2});
+    BagContainerAdaptor<int, PoolList> otherPooled;
+    otherPooled.insert({3, 4});
+
+    pooled.merge(std::move(otherPooled));
+    EXPECT_EQ(pooled.size(), 4);
+    EXPECT_EQ(pooled.count(4), 1);
+    EXPECT_TRUE(otherPooled.empty());
 }
@@ -1,7 +1,11 @@
 #include <gtest/gtest.h>
 
 #include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/counted_multiset.hpp>
 #include <BagContainerAdaptor/linked_list.hpp>
+#include <BagContainerAdaptor/pool_allocator.hpp>
+#include <BagContainerAdaptor/small_vector.hpp>
+#include <BagContainerAdaptor/unrolled_linked_list.hpp>
 
 #include <list>
 
@@ -21,6 +25,59 @@ protected:
         EXPECT_EQ(adapter.size(), 3);
     }
 
+    void insertMoveTest()
+    {
+        BagContainerAdaptor<int, Container> adapter;
+
+        int value = 4;
+        adapter.insert(std::move(value));
+        adapter.insert(5);
+
+        EXPECT_EQ(adapter.size(), 2);
+        EXPECT_TRUE(adapter.find(4) != adapter.end());
+    }
+
+    void emplaceTest()
+    {
+        BagContainerAdaptor<int, Container> adapter;
+
+        auto it = adapter.emplace(7);
+        EXPECT_EQ(*it, 7);
+
+        adapter.emplace(8);
+
+        EXPECT_EQ(adapter.size(), 2);
+        EXPECT_TRUE(adapter.find(8) != adapter.end());
+    }
+
+    void insertRangeTest()
+    {
+        BagContainerAdaptor<int, Container> adapter;
+        std::vector<int> values{1, 2, 3, 4};
+
+        adapter.insert(values.begin(), values.end());
+        adapter.insert({5, 6});
+
+        EXPECT_EQ(adapter.size(), 6);
+        EXPECT_TRUE(adapter.find(4) != adapter.end());
+        EXPECT_TRUE(adapter.find(6) != adapter.end());
+    }
+
+    void reserveTest()
+    {
+        BagContainerAdaptor<int, Container> adapter;
+
+        adapter.reserve(100);
+        EXPECT_TRUE(adapter.empty());
+
+        for (int i = 0; i < 100; i++)
+        {
+            adapter.insert(i);
+        }
+
+        EXPECT_EQ(adapter.size(), 100);
+    }
+
     void eraseTest1()
     {
         BagContainerAdaptor<int, Container> adapter;
@@ -46,7 +103,7 @@ protected:
 
         EXPECT_EQ(adapter.size(), 3);
 
-        adapter.erase(2);
+        EXPECT_EQ(adapter.erase(2), 1);
 
         EXPECT_EQ(adapter.size(), 2);
     }
@@ -63,11 +120,49 @@ protected:
 
         EXPECT_EQ(adapter.size(), 5);
 
-        adapter.erase(2);
+        EXPECT_EQ(adapter.erase(2), 3);
+        EXPECT_EQ(adapter.erase(2), 0);
 
         EXPECT_EQ(adapter.size(), 2);
     }
 
+    void eraseIfTest()
+    {
+        BagContainerAdaptor<int, Container> adapter;
+
+        for (int i = 0; i < 100; i++)
+        {
+            adapter.insert(i);
+        }
+
+        EXPECT_EQ(adapter.erase_if([](int value) { return value % 2 == 0; }), 50);
+        EXPECT_EQ(adapter.size(), 50);
+
+        int sum = 0;
+        for (auto it = adapter.cbegin(); it != adapter.cend(); ++it)
+        {
+            EXPECT_EQ(*it % 2, 1);
+            sum += *it;
+        }
+        EXPECT_EQ(sum, 2500);
+
+        EXPECT_EQ(adapter.erase_if([](int) { return true; }), 50);
+        EXPECT_TRUE(adapter.empty());
+    }
+
+    void countTest()
+    {
+        BagContainerAdaptor<int, Container> adapter;
+
+        adapter.insert({4, 1, 4, 2, 4, 3});
+
+        EXPECT_EQ(adapter.count(4), 3);
+        EXPECT_EQ(adapter.count(1), 1);
+        EXPECT_EQ(adapter.count(9), 0);
+        EXPECT_EQ(adapter.count_if([](int value) { return value < 3; }), 2);
+        EXPECT_EQ(adapter.count_if([](int value) { return value > 9; }), 0);
+    }
+
     void findTest()
     {
         BagContainerAdaptor<int, Container> adapter;
@@ -190,6 +285,34 @@ protected:
 
         EXPECT_EQ(adapter.size(), adapter2.size());
     }
+
+    void mergeTest()
+    {
+        BagContainerAdaptor<int, Container> adapter;
+        adapter.insert({1, 2, 3});
+        BagContainerAdaptor<int, Container> other;
+        other.insert({3, 4});
+
+        adapter.merge(std::move(other));
+        EXPECT_EQ(adapter.size(), 5);
+        EXPECT_EQ(adapter.count(3), 2);
+        EXPECT_TRUE(adapter.find(4) != adapter.end());
+        EXPECT_TRUE(adapter.find(adapter.back()) != adapter.end());
+        EXPECT_TRUE(other.empty());
+
+        // Both bags keep working after the merge.
+        other.insert(6);
+        EXPECT_EQ(other.back(), 6);
+        adapter.insert(7);
+        EXPECT_EQ(adapter.erase(3), 2);
+        EXPECT_EQ(adapter.size(), 4);
+
+        BagContainerAdaptor<int, Container> empty;
+        empty.merge(std::move(adapter));
+        EXPECT_EQ(empty.size(), 4);
+        EXPECT_TRUE(empty.find(empty.back()) != empty.end());
+        EXPECT_TRUE(adapter.empty());
+    }
 };
 
 using MainContainerTypes = ::testing::Types<
@@ -198,7 +321,16 @@ using MainContainerTypes = ::testing::Types<
     std::deque<int>,
     std::forward_list<int>,
     std::multiset<int>,
-    std::unordered_multiset<int>>;
+    std::unordered_multiset<int>,
+    IndexedVector<int>,
+    UnrolledLinkedList<int>,
+    SmallVector<int, 16>,
+    CountedMultiset<int>,
+    LinkedList<int>,
+    LinkedList<int, PoolAllocator<LinkedListNode<int>>>,
+    std::list<int, PoolAllocator<int>>,
+    std::forward_list<int, PoolAllocator<int>>,
+    std::multiset<int, std::less<int>, PoolAllocator<int>>>;
 
 TYPED_TEST_SUITE(BagContainerAdaptorTest, MainContainerTypes);
 
@@ -207,6 +339,26 @@ TYPED_TEST(BagContainerAdaptorTest, insertTest)
     this->insertTest();
 }
 
+TYPED_TEST(BagContainerAdaptorTest, insertMoveTest)
+{
+    this->insertMoveTest();
+}
+
+TYPED_TEST(BagContainerAdaptorTest, emplaceTest)
+{
+    this->emplaceTest();
+}
+
+TYPED_TEST(BagContainerAdaptorTest, insertRangeTest)
+{
+    this->insertRangeTest();
+}
+
+TYPED_TEST(BagContainerAdaptorTest, reserveTest)
+{
+    this->reserveTest();
+}
+
 TYPED_TEST(BagContainerAdaptorTest, eraseTest1)
 {
     this->eraseTest1();
@@ -222,6 +374,16 @@ TYPED_TEST(BagContainerAdaptorTest, eraseTestMultiple)
     this->eraseTestMultiple();
 }
 
+TYPED_TEST(BagContainerAdaptorTest, eraseIfTest)
+{
+    this->eraseIfTest();
+}
+
+TYPED_TEST(BagContainerAdaptorTest, countTest)
+{
+    this->countTest();
+}
+
 TYPED_TEST(BagContainerAdaptorTest, findTest)
 {
     this->findTest();
@@ -272,6 +434,11 @@ TYPED_TEST(BagContainerAdaptorTest, copyAssignmentTest)
     this->copyAssignmentTest();
 }
 
+TYPED_TEST(BagContainerAdaptorTest, mergeTest)
+{
+    this->mergeTest();
+}
+
 int main(int argc, char** argv)
 {
     testing::InitGoogleTest(&argc, argv);
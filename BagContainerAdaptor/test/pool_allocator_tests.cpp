@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/linked_list.hpp>
+#include <BagContainerAdaptor/pool_allocator.hpp>
+
+#include <cstdint>
+#include <forward_list>
+#include <limits>
+#include <list>
+#include <memory>
+#include <new>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+TEST(PoolAllocator, ReusesFreedBlocks)
+{
+    PoolAllocator<int> allocator;
+
+    int* first = allocator.allocate(1);
+    int* second = allocator.allocate(1);
+    allocator.deallocate(first, 1);
+
+    EXPECT_EQ(allocator.allocate(1), first);
+    EXPECT_NE(allocator.allocate(1), second);
+}
+
+TEST(PoolAllocator, RejectsOverflowingArrays)
+{
+    PoolAllocator<std::uint64_t> allocator;
+
+    EXPECT_EQ(allocator.max_size(), std::numeric_limits<std::size_t>::max() / sizeof(std::uint64_t));
+    EXPECT_THROW(allocator.allocate(allocator.max_size() + 1), std::bad_array_new_length);
+}
+
+TEST(PoolAllocator, CarvesBlocksFromGrowingChunks)
+{
+    PoolAllocator<double> allocator;
+    std::vector<double*> blocks;
+
+    for (int i = 0; i < 1000; i++)
+    {
+        blocks.push_back(allocator.allocate(1));
+        *blocks.back() = i;
+    }
+
+    // Chunks of 32, 64, 128, 256 and 512 blocks hold 992 blocks, the rest goes to a sixth chunk.
+    const PoolArena::Pool* pool = allocator.arena()->find(sizeof(double), alignof(double));
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(pool->chunkCount(), 6);
+    EXPECT_EQ(pool->liveBlocks(), 1000);
+
+    for (int i = 0; i < 1000; i++)
+    {
+        EXPECT_EQ(*blocks[static_cast<std::size_t>(i)], i);
+        allocator.deallocate(blocks[static_cast<std::size_t>(i)], 1);
+    }
+    EXPECT_EQ(pool->liveBlocks(), 0);
+}
+
+TEST(PoolAllocator, ReleaseRequiresOwningEveryBlock)
+{
+    PoolAllocator<int> allocator;
+    allocator.allocate(1);
+    allocator.allocate(1);
+
+    EXPECT_FALSE(allocator.release(1));
+    EXPECT_TRUE(allocator.release(2));
+    EXPECT_EQ(allocator.arena()->find(sizeof(int), alignof(int))->chunkCount(), 0);
+}
+
+TEST(PoolAllocator, RebindSharesArena)
+{
+    PoolAllocator<int> allocator;
+    PoolAllocator<std::string> rebound(allocator);
+
+    EXPECT_TRUE(allocator == rebound);
+    EXPECT_TRUE(allocator != PoolAllocator<int>());
+
+    // Memory allocated through one copy can be deallocated through another.
+    std::string* block = rebound.allocate(1);
+    PoolAllocator<std::string>(allocator).deallocate(block, 1);
+}
+
+TEST(PoolAllocator, LinkedListClearReleasesChunks)
+{
+    LinkedList<int, PoolAllocator<LinkedListNode<int>>> list;
+
+    for (int i = 0; i < 100000; i++)
+    {
+        list.insert(i);
+    }
+
+    auto allocator = list.get_allocator();
+    const PoolArena::Pool* pool = allocator.arena()->find(sizeof(LinkedListNode<int>), alignof(LinkedListNode<int>));
+    ASSERT_NE(pool, nullptr);
+    EXPECT_EQ(pool->liveBlocks(), 100000);
+
+    list.clear();
+
+    EXPECT_EQ(pool->chunkCount(), 0);
+    EXPECT_TRUE(list.empty());
+
+    list.insert(5);
+    EXPECT_EQ(list.size(), 1);
+    EXPECT_EQ(*list.begin(), 5);
+}
+
+TEST(PoolAllocator, StdContainersShareArena)
+{
+    PoolAllocator<int> allocator;
+    std::list<int, PoolAllocator<int>> list(allocator);
+    std::multiset<int, std::less<int>, PoolAllocator<int>> set(allocator);
+
+    for (int i = 0; i < 100; i++)
+    {
+        list.push_back(i);
+        set.insert(i);
+    }
+
+    list.clear();
+    set.clear();
+
+    for (int i = 0; i < 100; i++)
+    {
+        list.push_back(i);
+    }
+
+    EXPECT_EQ(list.size(), 100);
+    EXPECT_EQ(list.get_allocator(), set.get_allocator());
+}
+
+TEST(PoolAllocator, ForwardListBagKeepsBookkeeping)
+{
+    BagContainerAdaptor<std::string, std::forward_list<std::string, PoolAllocator<std::string>>> adapter;
+
+    adapter.insert("first");
+    adapter.insert("second");
+    adapter.insert("third");
+    adapter.erase(adapter.find("first"));
+
+    EXPECT_EQ(adapter.size(), 2);
+    EXPECT_EQ(adapter.count("second"), 1);
+    EXPECT_EQ(adapter.erase_if([](const std::string& value) { return value == "third"; }), 1);
+    EXPECT_EQ(adapter.back(), "second");
+}
+
+TEST(PoolAllocator, MovedFromAllocatorSharesArena)
+{
+    PoolAllocator<int> allocator;
+    int* pointer = allocator.allocate(1);
+
+    PoolAllocator<int> moved(std::move(allocator));
+    EXPECT_EQ(allocator, moved);
+    allocator.deallocate(pointer, 1);
+
+    PoolAllocator<int> assigned;
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned, moved);
+    pointer = moved.allocate(1);
+    assigned.deallocate(pointer, 1);
+
+    // Allocation in the default constructor may throw, so the containers do not promise noexcept construction.
+    static_assert(!std::is_nothrow_default_constructible<LinkedList<int, PoolAllocator<LinkedListNode<int>>>>::value, "");
+    static_assert(!std::is_nothrow_default_constructible<BagContainerAdaptor<int, std::list<int, PoolAllocator<int>>>>::value, "");
+    static_assert(std::is_nothrow_default_constructible<BagContainerAdaptor<int, std::vector<int>>>::value, "");
+}
+
+TEST(PoolAllocator, MovedListsStayUsable)
+{
+    {
+        auto source = std::unique_ptr<std::list<int, PoolAllocator<int>>>(new std::list<int, PoolAllocator<int>>{1, 2, 3});
+        std::list<int, PoolAllocator<int>> target(std::move(*source));
+        source->push_back(4);
+        source.reset();
+
+        target.push_back(5);
+        EXPECT_EQ(target.size(), 4);
+    }
+
+    BagContainerAdaptor<int, std::list<int, PoolAllocator<int>>> b;
+    b.insert({1, 2});
+    {
+        BagContainerAdaptor<int, std::list<int, PoolAllocator<int>>> a;
+        a = std::move(b);
+        EXPECT_EQ(a.size(), 2);
+    }
+    b.insert(3);
+    b.insert(4);
+    EXPECT_EQ(b.count(3), 1);
+    EXPECT_EQ(b.erase(4), 1);
+}
+
+TEST(PoolAllocator, MovedLinkedListStaysUsable)
+{
+    using List = LinkedList<int, PoolAllocator<LinkedListNode<int>>>;
+
+    List source;
+    source.insert(1);
+    {
+        List target(std::move(source));
+        EXPECT_EQ(target.size(), 1);
+    }
+    source.insert(2);
+    source.insert(3);
+    EXPECT_EQ(source.size(), 2);
+
+    List assigned;
+    assigned = std::move(source);
+    source.insert(4);
+    EXPECT_EQ(assigned.size(), 2);
+    EXPECT_EQ(*source.begin(), 4);
+}
@@ -0,0 +1,61 @@
+#ifndef RANDOM_OPERATIONS_HPP
+#define RANDOM_OPERATIONS_HPP
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+// Drive a container with random inserts, erases and counts, and compare it with a std::multiset after every operation.
+// The backend wraps the container under test and provides:
+// - void insert(int value)
+// - int eraseAt(std::size_t position), which erases the element at the position in iteration order and returns its value.
+// - std::size_t erase(int value), which erases all elements equal to the value and returns their amount.
+// - std::size_t count(int value) const
+// - std::vector<int> values() const, the elements in iteration order.
+// - void check(const std::multiset<int>& reference) const, for the checks that are specific to the container.
+// The reference is left with the expected elements, so that the test can check the final state of the container against it.
+template <typename Backend>
+void runRandomOperations(Backend& backend, std::multiset<int>& reference, unsigned seed, int maxValue)
+{
+    std::mt19937 generator(seed);
+    std::uniform_int_distribution<int> values(0, maxValue);
+    std::uniform_int_distribution<int> operations(0, 9);
+
+    for (int i = 0; i < 5000; i++)
+    {
+        const int value = values(generator);
+        const int operation = operations(generator);
+
+        if (operation < 6)
+        {
+            backend.insert(value);
+            reference.insert(value);
+        }
+        else if (operation < 8 && !reference.empty())
+        {
+            const int erased = backend.eraseAt(static_cast<std::size_t>(value) % reference.size());
+            auto found = reference.find(erased);
+            ASSERT_NE(found, reference.end());
+            reference.erase(found);
+        }
+        else if (operation == 8)
+        {
+            EXPECT_EQ(backend.erase(value), reference.erase(value));
+        }
+        else
+        {
+            EXPECT_EQ(backend.count(value), reference.count(value));
+        }
+
+        ASSERT_NO_FATAL_FAILURE(backend.check(reference));
+    }
+
+    const std::vector<int> contents = backend.values();
+    EXPECT_EQ(std::multiset<int>(contents.begin(), contents.end()), reference);
+}
+
+#endif
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/simd_search.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <set>
+#include <vector>
+
+template <typename T>
+class SimdSearchTest : public ::testing::Test
+{
+protected:
+    // Values from a small set, so that every length has both hits and misses.
+    static std::vector<T> randomValues(std::size_t length, std::mt19937& generator)
+    {
+        std::uniform_int_distribution<int> values(0, 7);
+        std::vector<T> result;
+        for (std::size_t i = 0; i < length; i++)
+        {
+            result.push_back(static_cast<T>(values(generator)));
+        }
+        return result;
+    }
+
+    void kernelsMatchScalarTest()
+    {
+        std::mt19937 generator(7);
+
+        // Lengths around the register widths, with an offset so that the loads are unaligned.
+        for (std::size_t length = 0; length < 80; length++)
+        {
+            std::vector<T> storage = randomValues(length + 1, generator);
+            const T* first = storage.data() + 1;
+            const T* last = storage.data() + storage.size();
+
+            for (int target = 0; target < 9; target++)
+            {
+                const T value = static_cast<T>(target);
+                const T* expectedFind = std::find(first, last, value);
+                const auto expectedCount = static_cast<std::size_t>(std::count(first, last, value));
+
+                EXPECT_EQ(SimdSearch<T>::find(first, last, value), expectedFind);
+                EXPECT_EQ(SimdSearch<T>::count(first, last, value), expectedCount);
+                EXPECT_EQ(SimdSearch<T>::findSse2(first, last, value), expectedFind);
+                EXPECT_EQ(SimdSearch<T>::countSse2(first, last, value), expectedCount);
+
+                if (SimdSearch<T>::hasAvx2())
+                {
+                    EXPECT_EQ(SimdSearch<T>::findAvx2(first, last, value), expectedFind);
+                    EXPECT_EQ(SimdSearch<T>::countAvx2(first, last, value), expectedCount);
+                }
+            }
+        }
+    }
+
+    void bagEraseValueTest()
+    {
+        std::mt19937 generator(11);
+
+        for (std::size_t length = 0; length < 80; length += 7)
+        {
+            const std::vector<T> values = randomValues(length, generator);
+
+            for (int target = 0; target < 9; target++)
+            {
+                BagContainerAdaptor<T, std::vector<T>> adapter;
+                adapter.insert(values.begin(), values.end());
+                std::multiset<T> reference(values.begin(), values.end());
+
+                EXPECT_EQ(adapter.erase(static_cast<T>(target)), reference.erase(static_cast<T>(target)));
+                EXPECT_EQ(std::multiset<T>(adapter.begin(), adapter.end()), reference);
+                EXPECT_EQ(adapter.find(static_cast<T>(target)), adapter.end());
+            }
+        }
+    }
+};
+
+using SimdSearchTypes = ::testing::Types<std::int8_t, std::uint16_t, int, std::size_t, float, double>;
+
+TYPED_TEST_SUITE(SimdSearchTest, SimdSearchTypes);
+
+TYPED_TEST(SimdSearchTest, kernelsMatchScalarTest)
+{
+    this->kernelsMatchScalarTest();
+}
+
+TYPED_TEST(SimdSearchTest, bagEraseValueTest)
+{
+    this->bagEraseValueTest();
+}
+
+TEST(SimdSearch, SupportedTypes)
+{
+    EXPECT_TRUE(IsSimdSearchable<int>::value);
+    EXPECT_TRUE(IsSimdSearchable<double>::value);
+    EXPECT_FALSE(IsSimdSearchable<bool>::value);
+    EXPECT_FALSE(IsSimdSearchable<long double>::value);
+}
+
+TEST(SimdSearch, FloatingPointEqualityFollowsOperator)
+{
+    std::vector<double> values(40, 1.0);
+    values[20] = std::numeric_limits<double>::quiet_NaN();
+    values[30] = -0.0;
+
+    BagContainerAdaptor<double, std::vector<double>> adapter;
+    adapter.insert(values.begin(), values.end());
+
+    EXPECT_EQ(adapter.find(std::numeric_limits<double>::quiet_NaN()), adapter.end());
+    EXPECT_EQ(adapter.count(0.0), 1);
+    EXPECT_EQ(adapter.find(0.0) - adapter.begin(), 30);
+}
+
+TEST(SimdSearch, Int64HalvesMustBothMatch)
+{
+    // Only the low or the high 32 bits are equal to those of the looked up value.
+    const std::int64_t value = 0x0000000100000002;
+    std::vector<std::int64_t> values{0x0000000000000002, 0x0000000100000000, 0x0000000300000002, value, 0x0000000100000002};
+
+    EXPECT_EQ(SimdSearch<std::int64_t>::findSse2(values.data(), values.data() + values.size(), value), values.data() + 3);
+    EXPECT_EQ(SimdSearch<std::int64_t>::countSse2(values.data(), values.data() + values.size(), value), 2);
+}
@@ -0,0 +1,234 @@
+#include <gtest/gtest.h>
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/slot_map.hpp>
+
+#include "random_operations.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+TEST(SlotMap, HandlesSurviveErasingOthers)
+{
+    SlotMap<std::string> map;
+    const auto a = map.insert("a");
+    const auto b = map.insert("b");
+    const auto c = map.insert("c");
+
+    EXPECT_TRUE(map.erase(a));
+
+    // The last element moved into the hole, but its handle still finds it.
+    EXPECT_EQ(map.size(), 2);
+    EXPECT_EQ(map[b], "b");
+    EXPECT_EQ(map[c], "c");
+    EXPECT_EQ(map.front(), "c");
+    EXPECT_EQ(map.handle(map.begin()), c);
+}
+
+TEST(SlotMap, StaleHandlesAreRejected)
+{
+    SlotMap<int> map;
+    const auto first = map.insert(1);
+    map.erase(first);
+
+    // The slot is reused, but the generation tells the handles apart.
+    const auto second = map.insert(2);
+    EXPECT_EQ(second.m_slot, first.m_slot);
+    EXPECT_NE(second, first);
+
+    EXPECT_FALSE(map.contains(first));
+    EXPECT_FALSE(map.erase(first));
+    EXPECT_EQ(map.find(first), map.end());
+    EXPECT_THROW(map.at(first), std::out_of_range);
+    EXPECT_FALSE(map.contains(SlotMapHandle()));
+    EXPECT_FALSE(map.contains(SlotMapHandle{5, 1}));
+
+    EXPECT_EQ(map.at(second), 2);
+    EXPECT_EQ(map.size(), 1);
+}
+
+TEST(SlotMap, ClearInvalidatesAllHandles)
+{
+    SlotMap<int> map{1, 2, 3};
+    std::vector<SlotMapHandle> handles;
+    for (auto it = map.cbegin(); it != map.cend(); ++it)
+    {
+        handles.push_back(map.handle(it));
+    }
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+    for (const auto& handle : handles)
+    {
+        EXPECT_FALSE(map.contains(handle));
+    }
+}
+
+TEST(SlotMap, FailedInsertKeepsMapUnchanged)
+{
+    struct Throwing
+    {
+        explicit Throwing(bool fail)
+        {
+            if (fail)
+            {
+                throw std::runtime_error("construction failed");
+            }
+        }
+    };
+
+    SlotMap<Throwing> map;
+    const auto handle = map.emplace(false);
+
+    EXPECT_THROW(map.emplace(true), std::runtime_error);
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_TRUE(map.contains(handle));
+
+    const auto next = map.emplace(false);
+    EXPECT_TRUE(map.contains(next));
+    EXPECT_EQ(map.size(), 2);
+}
+
+// Random operations on a slot map, keeping the handle of every element to check that it still refers to the element.
+struct SlotMapBackend
+{
+    void insert(int value)
+    {
+        const auto handle = map.insert(value);
+        live[handle.m_slot] = {handle, value};
+    }
+
+    int eraseAt(std::size_t position)
+    {
+        auto it = map.begin() + static_cast<std::ptrdiff_t>(position);
+        const auto handle = map.handle(it);
+        const int value = *it;
+        EXPECT_TRUE(map.erase(handle));
+        forget(live.find(handle.m_slot));
+        return value;
+    }
+
+    std::size_t erase(int value)
+    {
+        const std::size_t removed = map.erase_if([value](int element) { return element == value; });
+        for (auto it = live.begin(); it != live.end();)
+        {
+            it = it->second.second == value ? forget(it) : std::next(it);
+        }
+        return removed;
+    }
+
+    std::size_t count(int value) const
+    {
+        return map.count(value);
+    }
+
+    std::vector<int> values() const
+    {
+        return std::vector<int>(map.cbegin(), map.cend());
+    }
+
+    void check(const std::multiset<int>&) const
+    {
+        ASSERT_EQ(map.size(), live.size());
+        for (const auto& entry : live)
+        {
+            ASSERT_TRUE(map.contains(entry.second.first));
+            EXPECT_EQ(map.at(entry.second.first), entry.second.second);
+        }
+    }
+
+    using Live = std::unordered_map<std::uint32_t, std::pair<SlotMapHandle, int>>;
+
+    Live::iterator forget(Live::iterator entry)
+    {
+        erased.push_back(entry->second.first);
+        return live.erase(entry);
+    }
+
+    SlotMap<int> map;
+    Live live;
+    std::vector<SlotMapHandle> erased;
+};
+
+TEST(SlotMap, RandomOperationsKeepHandlesValid)
+{
+    SlotMapBackend backend;
+    std::multiset<int> reference;
+    runRandomOperations(backend, reference, 11, 31);
+
+    // Slots are reused, but the generations keep the handles of erased elements stale.
+    for (const auto& handle : backend.erased)
+    {
+        EXPECT_FALSE(backend.map.contains(handle));
+    }
+}
+
+TEST(SlotMap, BagReturnsStableHandles)
+{
+    BagContainerAdaptor<int, SlotMap<int>> adapter;
+    std::vector<BagContainerAdaptor<int, SlotMap<int>>::handle_type> handles;
+
+    for (int i = 0; i < 100; i++)
+    {
+        handles.push_back(adapter.insert(i % 10));
+    }
+
+    EXPECT_TRUE(adapter.erase(handles[0]));
+    EXPECT_FALSE(adapter.erase(handles[0]));
+    EXPECT_EQ(adapter.erase(5), 10);
+    EXPECT_EQ(adapter.erase_if([](int value) { return value > 7; }), 20);
+    adapter.erase(adapter.find(1));
+
+    EXPECT_EQ(adapter.size(), 68);
+    EXPECT_EQ(adapter.count(0), 9);
+    EXPECT_EQ(adapter.count(1), 9);
+
+    for (std::size_t i = 0; i < handles.size(); i++)
+    {
+        const int value = static_cast<int>(i % 10);
+        if (adapter.contains(handles[i]))
+        {
+            EXPECT_EQ(adapter.at(handles[i]), value);
+            EXPECT_EQ(*adapter.find(handles[i]), value);
+        }
+    }
+
+    const auto moved = adapter.emplace(42);
+    BagContainerAdaptor<int, SlotMap<int>> other;
+    other.swap(adapter);
+    EXPECT_EQ(other.at(moved), 42);
+    EXPECT_EQ(adapter.find(moved), adapter.end());
+}
+
+TEST(SlotMap, BagMergeKeepsOwnHandles)
+{
+    BagContainerAdaptor<std::string, SlotMap<std::string>> adapter;
+    BagContainerAdaptor<std::string, SlotMap<std::string>> other;
+
+    const auto own = adapter.insert("own");
+    const auto moved = other.insert("moved");
+    other.insert("also moved");
+
+    adapter.merge(std::move(other));
+    EXPECT_EQ(adapter.size(), 3);
+    EXPECT_TRUE(other.empty());
+    EXPECT_EQ(adapter.at(own), "own");
+    EXPECT_EQ(adapter.count("moved"), 1);
+    EXPECT_EQ(adapter.count("also moved"), 1);
+
+    // The handles of the merged bag are stale, the moved element has a new handle in this bag.
+    EXPECT_FALSE(other.contains(moved));
+    const auto found = adapter.find(std::string("moved"));
+    ASSERT_NE(found, adapter.end());
+    EXPECT_EQ(adapter.at(adapter.handle(found)), "moved");
+
+    adapter.merge(std::move(adapter));
+    EXPECT_EQ(adapter.size(), 3);
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/small_vector.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(SmallVector, StaysInlineUpToCapacity)
+{
+    SmallVector<int, 4> small;
+
+    for (int i = 0; i < 4; i++)
+    {
+        small.push_back(i);
+        EXPECT_TRUE(small.isInline());
+    }
+    EXPECT_EQ(small.capacity(), 4);
+
+    small.push_back(4);
+    EXPECT_FALSE(small.isInline());
+    EXPECT_EQ(small.capacity(), 8);
+    EXPECT_EQ(std::vector<int>(small.begin(), small.end()), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    // Once on the heap the storage is kept, even when the elements would fit inline again.
+    small.clear();
+    EXPECT_FALSE(small.isInline());
+}
+
+TEST(SmallVector, GrowingCopiesElementOfItself)
+{
+    SmallVector<std::string, 2> small{"first", "second"};
+
+    small.push_back(small.front());
+    small.emplace_back(small.back());
+
+    EXPECT_EQ(std::vector<std::string>(small.begin(), small.end()), (std::vector<std::string>{"first", "second", "first", "first"}));
+}
+
+TEST(SmallVector, InsertAndEraseKeepOrder)
+{
+    SmallVector<int, 4> small{1, 2, 4};
+
+    EXPECT_EQ(*small.insert(small.begin() + 2, 3), 3);
+    EXPECT_EQ(*small.insert(small.begin(), 0), 0);
+    EXPECT_EQ(std::vector<int>(small.begin(), small.end()), (std::vector<int>{0, 1, 2, 3, 4}));
+
+    EXPECT_EQ(*small.erase(small.begin() + 1), 2);
+    auto it = small.erase(small.begin() + 2, small.end());
+    EXPECT_EQ(it, small.end());
+    EXPECT_EQ(std::vector<int>(small.begin(), small.end()), (std::vector<int>{0, 2}));
+}
+
+TEST(SmallVector, CopyMoveAndSwap)
+{
+    SmallVector<std::unique_ptr<int>, 2> inlineElements;
+    inlineElements.emplace_back(new int(1));
+
+    SmallVector<std::unique_ptr<int>, 2> heapElements;
+    for (int i = 0; i < 3; i++)
+    {
+        heapElements.emplace_back(new int(10 + i));
+    }
+    const int* heapFront = heapElements.front().get();
+
+    // Heap storage changes owner without moving the elements, inline elements are moved one by one.
+    inlineElements.swap(heapElements);
+    EXPECT_EQ(inlineElements.size(), 3);
+    EXPECT_EQ(inlineElements.front().get(), heapFront);
+    EXPECT_TRUE(heapElements.isInline());
+    EXPECT_EQ(*heapElements.front(), 1);
+
+    SmallVector<std::unique_ptr<int>, 2> moved(std::move(inlineElements));
+    EXPECT_TRUE(inlineElements.empty());
+    EXPECT_TRUE(inlineElements.isInline());
+    EXPECT_EQ(*moved.back(), 12);
+
+    SmallVector<std::string, 2> strings{"a", "b", "c"};
+    SmallVector<std::string, 2> copy;
+    copy = strings;
+    EXPECT_EQ(std::vector<std::string>(copy.begin(), copy.end()), (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST(SmallVector, FailedGrowthKeepsElements)
+{
+    struct Throwing
+    {
+        explicit Throwing(int value)
+            : m_value(value)
+        {
+            if (value < 0)
+            {
+                throw std::runtime_error("construction failed");
+            }
+        }
+
+        int m_value;
+    };
+
+    SmallVector<Throwing, 2> small;
+    small.emplace_back(1);
+    small.emplace_back(2);
+
+    EXPECT_THROW(small.emplace_back(-1), std::runtime_error);
+    EXPECT_TRUE(small.isInline());
+    ASSERT_EQ(small.size(), 2);
+    EXPECT_EQ(small.back().m_value, 2);
+}
+
+TEST(SmallVector, SmallBagDoesNotSpill)
+{
+    BagContainerAdaptor<int, SmallVector<int, 16>> adapter;
+
+    for (int i = 0; i < 16; i++)
+    {
+        adapter.insert(i % 4);
+    }
+
+    EXPECT_EQ(adapter.count(3), 4);
+    adapter.erase(adapter.find(0));
+    EXPECT_EQ(adapter.erase(1), 4);
+    EXPECT_EQ(adapter.erase_if([](int value) { return value == 2; }), 4);
+    EXPECT_EQ(adapter.size(), 7);
+    EXPECT_EQ(adapter.count(0), 3);
+
+    adapter.insert({5, 6, 7, 8, 9, 10, 11, 12, 13, 14});
+    EXPECT_EQ(adapter.size(), 17);
+    EXPECT_EQ(*adapter.find(14), 14);
+}
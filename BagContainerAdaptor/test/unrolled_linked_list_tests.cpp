@@ -0,0 +1,237 @@
+#include <gtest/gtest.h>
+
+#include <BagContainerAdaptor/bag_container_adaptor.hpp>
+#include <BagContainerAdaptor/unrolled_linked_list.hpp>
+
+#include "random_operations.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// A small node capacity, so that splitting and merging happen after a few elements.
+using SmallUnrolledList = UnrolledLinkedList<int, 4>;
+
+// Check that the list holds the same elements in the same order as the reference, in both directions.
+template <typename List>
+void expectSameOrder(const List& list, const std::list<int>& reference)
+{
+    ASSERT_EQ(list.size(), reference.size());
+    EXPECT_EQ(std::vector<int>(list.begin(), list.end()), std::vector<int>(reference.begin(), reference.end()));
+    EXPECT_EQ(std::vector<int>(list.crbegin(), list.crend()), std::vector<int>(reference.rbegin(), reference.rend()));
+}
+
+TEST(UnrolledLinkedList, DefaultCapacityFillsTwoCacheLines)
+{
+    EXPECT_EQ(UnrolledLinkedList<int>::nodeCapacity, (128 - 3 * sizeof(void*)) / sizeof(int));
+    EXPECT_EQ(UnrolledLinkedList<std::string>::nodeCapacity, 4);
+}
+
+TEST(UnrolledLinkedList, AppendKeepsOrder)
+{
+    SmallUnrolledList list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    expectSameOrder(list, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    EXPECT_EQ(list.front(), 1);
+    EXPECT_EQ(list.back(), 9);
+}
+
+TEST(UnrolledLinkedList, IteratorsAreBidirectional)
+{
+    static_assert(std::is_same<std::iterator_traits<SmallUnrolledList::iterator>::iterator_category, std::bidirectional_iterator_tag>::value,
+                  "UnrolledLinkedList iterators are bidirectional.");
+
+    const SmallUnrolledList list{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    // Stepping back crosses the node boundaries, from the end onto the last node.
+    EXPECT_EQ(*std::prev(list.end()), 9);
+    EXPECT_EQ(*std::prev(list.end(), 5), 5);
+    EXPECT_EQ(*std::prev(std::next(list.begin(), 4)), 4);
+    EXPECT_EQ(std::vector<int>(list.rbegin(), list.rend()), (std::vector<int>{9, 8, 7, 6, 5, 4, 3, 2, 1}));
+
+    SmallUnrolledList::const_reverse_iterator last = list.rbegin();
+    EXPECT_EQ(*last, 9);
+    EXPECT_EQ(std::next(last).base(), std::prev(list.end()));
+
+    const SmallUnrolledList empty;
+    EXPECT_EQ(empty.rbegin(), empty.rend());
+}
+
+TEST(UnrolledLinkedList, InsertIntoFullNodeSplitsIt)
+{
+    SmallUnrolledList list{1, 2, 3, 4};
+
+    auto it = list.insert(std::next(list.begin(), 1), 10);
+    EXPECT_EQ(*it, 10);
+    it = list.insert(std::next(list.begin(), 4), 20);
+    EXPECT_EQ(*it, 20);
+    list.insert(list.end(), 30);
+
+    expectSameOrder(list, {1, 10, 2, 3, 20, 4, 30});
+}
+
+TEST(UnrolledLinkedList, EraseMergesNeighbourNodes)
+{
+    SmallUnrolledList list{1, 2, 3, 4, 5, 6};
+
+    auto it = list.erase(std::next(list.begin(), 1));
+    EXPECT_EQ(*it, 3);
+
+    // The first node has room for the second node now, so the elements after the erased one move in.
+    it = list.erase(it);
+    EXPECT_EQ(*it, 4);
+    it = list.erase(it);
+    EXPECT_EQ(*it, 5);
+
+    expectSameOrder(list, {1, 5, 6});
+    EXPECT_EQ(list.erase(list.find(6)), list.end());
+    expectSameOrder(list, {1, 5});
+}
+
+TEST(UnrolledLinkedList, EraseRangeAndValue)
+{
+    SmallUnrolledList list{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+    auto it = list.erase(list.find(3), list.find(8));
+    EXPECT_EQ(*it, 8);
+    expectSameOrder(list, {1, 2, 8, 9, 10});
+
+    EXPECT_EQ(list.erase(42), list.end());
+    EXPECT_EQ(*list.erase(9), 10);
+    expectSameOrder(list, {1, 2, 8, 10});
+}
+
+TEST(UnrolledLinkedList, FindAndCountAcrossNodes)
+{
+    UnrolledLinkedList<std::string, 2> strings{"a", "b", "c", "b", "d"};
+
+    EXPECT_EQ(strings.count("b"), 2);
+    EXPECT_EQ(*strings.find("d"), "d");
+    EXPECT_EQ(strings.find("e"), strings.end());
+
+    const SmallUnrolledList numbers{5, 1, 5, 2, 5, 3};
+    EXPECT_EQ(numbers.count(5), 3);
+    EXPECT_EQ(std::distance(numbers.begin(), numbers.find(3)), 5);
+}
+
+TEST(UnrolledLinkedList, CopyAndMove)
+{
+    SmallUnrolledList list{1, 2, 3, 4, 5};
+    SmallUnrolledList copy(list);
+    copy.insert(6);
+
+    SmallUnrolledList moved(std::move(copy));
+    EXPECT_TRUE(copy.empty());
+    EXPECT_EQ(copy.begin(), copy.end());
+
+    list = moved;
+    expectSameOrder(list, {1, 2, 3, 4, 5, 6});
+
+    moved = SmallUnrolledList{7};
+    expectSameOrder(moved, {7});
+}
+
+// Random operations on a list with small nodes, so that they cross the node boundaries.
+// A std::list mirrors the list, because the order of the elements must be kept through splitting and merging nodes.
+struct UnrolledLinkedListBackend
+{
+    void insert(int value)
+    {
+        // Odd values are appended, even values are inserted in the middle, splitting full nodes.
+        if (value % 2 == 1 || order.empty())
+        {
+            list.insert(value);
+            order.push_back(value);
+            return;
+        }
+
+        const auto offset = static_cast<std::ptrdiff_t>(static_cast<std::size_t>(value) % order.size());
+        EXPECT_EQ(*list.insert(std::next(list.begin(), offset), value), value);
+        order.insert(std::next(order.begin(), offset), value);
+    }
+
+    int eraseAt(std::size_t position)
+    {
+        const auto offset = static_cast<std::ptrdiff_t>(position);
+        auto erased = std::next(order.begin(), offset);
+        const int value = *erased;
+        order.erase(erased);
+
+        if (position == order.size())
+        {
+            list.pop_back();
+            return value;
+        }
+
+        // The returned iterator stays at the position, also when the next node is merged in.
+        auto it = list.erase(std::next(list.begin(), offset));
+        EXPECT_EQ(std::distance(list.begin(), it), offset);
+        return value;
+    }
+
+    std::size_t erase(int value)
+    {
+        std::size_t removed = 0;
+        for (auto it = list.find(value); it != list.end(); it = list.find(value))
+        {
+            list.erase(it);
+            removed++;
+        }
+        order.remove(value);
+        return removed;
+    }
+
+    std::size_t count(int value) const
+    {
+        return list.count(value);
+    }
+
+    std::vector<int> values() const
+    {
+        return std::vector<int>(list.begin(), list.end());
+    }
+
+    void check(const std::multiset<int>&) const
+    {
+        ASSERT_EQ(list.size(), order.size());
+        if (!order.empty())
+        {
+            EXPECT_EQ(list.front(), order.front());
+            EXPECT_EQ(list.back(), order.back());
+        }
+    }
+
+    SmallUnrolledList list;
+    std::list<int> order;
+};
+
+TEST(UnrolledLinkedList, RandomOperationsKeepOrder)
+{
+    UnrolledLinkedListBackend backend;
+    std::multiset<int> reference;
+    runRandomOperations(backend, reference, 7, 63);
+
+    expectSameOrder(backend.list, backend.order);
+}
+
+TEST(UnrolledLinkedList, BagEraseFillsHolesFromBack)
+{
+    BagContainerAdaptor<int, SmallUnrolledList> adapter;
+
+    for (int i = 0; i < 100; i++)
+    {
+        adapter.insert(i % 10);
+    }
+
+    adapter.erase(adapter.find(0));
+    EXPECT_EQ(adapter.count(0), 9);
+    EXPECT_EQ(adapter.erase(3), 10);
+    EXPECT_EQ(adapter.erase_if([](int value) { return value % 2 == 0; }), 49);
+    EXPECT_EQ(adapter.size(), 40);
+    EXPECT_EQ(adapter.count(9), 10);
+    EXPECT_EQ(adapter.find(4), adapter.end());
+}